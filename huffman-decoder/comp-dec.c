@@ -1,12 +1,16 @@
 #include <assert.h>
 #include <byteswap.h>
 #include <arpa/inet.h>
+#include <errno.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h> /* For ssize_t */
 
+#include "litespeed-arena.h"
+#include "litespeed-stream.h"
+
 
 int
 lshpack_dec_huff_decode (const unsigned char *src, int src_len,
@@ -16,26 +20,950 @@ int
 lshpack_dec_huff_decode_full (const unsigned char *src, int src_len,
                                             unsigned char *dst, int dst_len);
 
+int
+lshpack_dec_huff_decode_2level (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_canonical (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_fsm8 (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_multi_init (unsigned bits);
+
+int
+lshpack_dec_huff_decode_multi12 (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_multi14 (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_multi16 (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_multi20 (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_multi22 (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_slack (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_padded (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_parallel (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_validate (const unsigned char *src, int src_len);
+
+int
+lshpack_dec_huff_decoded_len (const unsigned char *src, int src_len);
+
+int
+lshpack_dec_huff_decode_name (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_value (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_hash (const unsigned char *src, int src_len,
+                    unsigned char *dst, int dst_len, uint32_t *hash);
+
+uint32_t
+lshpack_huff_hash (const unsigned char *buf, int len);
+
+int
+lshpack_dec_huff_match (const unsigned char *src, int src_len);
+
+int
+lshpack_dict_lookup (const unsigned char *str, int len);
+
+const char *
+lshpack_dict_string (unsigned id, int *len);
+
+int
+lshpack_dec_huff_decode_uint (const unsigned char *src, int src_len,
+                                                            uint64_t *value);
+
+int
+lshpack_dec_huff_decode_path (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_cookie (const unsigned char *src, int src_len,
+        unsigned char *dst, int dst_len, unsigned *crumbs, unsigned *n_crumbs);
+
+int
+lshpack_dec_huff_decode_bounded (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_batch (unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        unsigned char *const *dsts, const int *dst_lens, int *results);
+
+int
+lshpack_dec_huff_decode_simd (unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        unsigned char *const *dsts, const int *dst_lens, int *results);
+
 int
 ngx_http_v2_huff_decode (const unsigned char *src, int len,
                                             unsigned char *dst, int dst_len);
 
+
+/* In corpus modes, the input file is a sequence of RFC 7541 string
+ * literals, such as produced by mk-corpus.  The input is parsed once and
+ * each string is given its own slot in the output buffer.  A slot is big
+ * enough for the longest possible output plus CORPUS_SLACK bytes, which
+ * lshpack_dec_huff_decode_slack() requires.
+ */
+#define MAX_CORPUS 0x400
+#define CORPUS_SLACK 3
+
+static struct
+{
+    const unsigned char *in;        /* Input that has been parsed */
+    unsigned             count;
+    const unsigned char *srcs[MAX_CORPUS];
+    int                  src_lens[MAX_CORPUS];
+    unsigned char       *dsts[MAX_CORPUS];
+    int                  dst_lens[MAX_CORPUS];
+    int                  results[MAX_CORPUS];
+} s_corpus;
+
+
+static int
+corpus_parse (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    const unsigned char *const in = src, *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    unsigned len, shift;
+
+    s_corpus.count = 0;
+    while (src < src_end)
+    {
+        if (s_corpus.count >= MAX_CORPUS || !(*src & 0x80))
+            return -1;      /* Too many strings or not Huffman-encoded */
+        len = *src++ & 0x7F;
+        if (len == 0x7F)
+        {
+            shift = 0;
+            do
+            {
+                if (src >= src_end || shift > 21)
+                    return -1;
+                len += (*src & 0x7F) << shift;
+                shift += 7;
+            }
+            while (*src++ & 0x80);
+        }
+        if (len > (unsigned) (src_end - src))
+            return -1;
+        /* Shortest code is 5 bits */
+        if (dst + len * 8 / 5 + CORPUS_SLACK > dst_end)
+            return -1;
+        s_corpus.srcs[s_corpus.count] = src;
+        s_corpus.src_lens[s_corpus.count] = len;
+        s_corpus.dsts[s_corpus.count] = dst;
+        s_corpus.dst_lens[s_corpus.count] = len * 8 / 5 + CORPUS_SLACK;
+        ++s_corpus.count;
+        src += len;
+        dst += len * 8 / 5 + CORPUS_SLACK;
+    }
+
+    s_corpus.in = in;
+    return 0;
+}
+
+
+/* lshpack_dec_huff_validate() writes no output */
+static int
+validate (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    return lshpack_dec_huff_validate(src, src_len);
+}
+
+
+/* Ways to get a string of exactly the decoded size: decode into scratch
+ * and copy, or count first and then decode in place.  Only the count is
+ * measured by itself.
+ */
+static int
+count_only (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    return lshpack_dec_huff_decoded_len(src, src_len);
+}
+
+
+static int
+decode_copy (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    static unsigned char scratch[0x20000];
+    int rv;
+
+    rv = lshpack_dec_huff_decode(src, src_len, scratch, sizeof(scratch));
+    if (rv > 0)
+        memcpy(dst, scratch, rv);
+    return rv;
+}
+
+
+static int
+count_decode (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    int len;
+
+    len = lshpack_dec_huff_decoded_len(src, src_len);
+    if (len < 0)
+        return len;
+    /* lshpack_dec_huff_decode() may fail if output fills dst exactly */
+    return lshpack_dec_huff_decode_2level(src, src_len, dst, len);
+}
+
+
+/* The checks of field names and values in RFC 9113, Section 8.2.1, done
+ * in a second pass after lshpack_dec_huff_decode(), as they are without
+ * litespeed-class.c.
+ */
+static int
+decode_name_scan (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    int len, i;
+
+    len = lshpack_dec_huff_decode(src, src_len, dst, dst_len);
+    if (len <= 0)
+        return len < 0 ? len : -3;
+    for (i = dst[0] == ':' && len > 1; i < len; ++i)
+        if (!((dst[i] >= 'a' && dst[i] <= 'z')
+                || (dst[i] >= '0' && dst[i] <= '9')
+                || (dst[i] && strchr("!#$%&'*+-.^_`|~", dst[i]))))
+            return -3;
+    return len;
+}
+
+
+static int
+decode_value_scan (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    int len, i;
+
+    len = lshpack_dec_huff_decode(src, src_len, dst, dst_len);
+    if (len <= 0)
+        return len;
+    for (i = 0; i < len; ++i)
+        if (dst[i] == '\0' || dst[i] == '\r' || dst[i] == '\n')
+            return -3;
+    if (dst[0] == ' ' || dst[0] == '\t'
+                            || dst[len - 1] == ' ' || dst[len - 1] == '\t')
+        return -3;
+    return len;
+}
+
+
+/* Hash of the last string decoded in hash modes */
+static uint32_t s_hash;
+
+
+static int
+decode_hash (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    return lshpack_dec_huff_decode_hash(src, src_len, dst, dst_len, &s_hash);
+}
+
+
+static int
+decode_then_hash (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    int len;
+
+    len = lshpack_dec_huff_decode(src, src_len, dst, dst_len);
+    if (len >= 0)
+        s_hash = lshpack_huff_hash(dst, len);
+    return len;
+}
+
+
+/* Dictionary index of the last string in dictionary modes */
+static int s_dict_id;
+
+
+/* Look the string up in the dictionary without decoding it; decode only
+ * if it is not there.
+ */
+static int
+match_or_decode (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    int len;
+
+    s_dict_id = lshpack_dec_huff_match(src, src_len);
+    if (s_dict_id >= 0)
+    {
+        (void) lshpack_dict_string(s_dict_id, &len);
+        return len;
+    }
+    else
+        return lshpack_dec_huff_decode(src, src_len, dst, dst_len);
+}
+
+
+/* Decode the string and then look it up */
+static int
+decode_lookup (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    int len;
+
+    len = lshpack_dec_huff_decode(src, src_len, dst, dst_len);
+    if (len >= 0)
+        s_dict_id = lshpack_dict_lookup(dst, len);
+    return len;
+}
+
+
+/* Number decoded last in number modes */
+static uint64_t s_number;
+
+
+static int
+decode_uint (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    return lshpack_dec_huff_decode_uint(src, src_len, &s_number);
+}
+
+
+/* Decode the number and then parse it, rejecting what
+ * lshpack_dec_huff_decode_uint() rejects.
+ */
+static int
+decode_strtoull (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    char *end;
+    int len;
+
+    len = lshpack_dec_huff_decode(src, src_len, dst, dst_len - 1);
+    if (len < 0)
+        return len;
+    if (len == 0 || dst[0] < '0' || dst[0] > '9')
+        return -3;
+    dst[len] = '\0';
+    errno = 0;
+    s_number = strtoull((char *) dst, &end, 10);
+    if (errno || end != (char *) dst + len)
+        return -3;
+    return len;
+}
+
+
+/* Reference :path normalizer, a pass of its own after
+ * lshpack_dec_huff_decode() for each step, which litespeed-path.c does in
+ * one.  Escapes that stand for '/', '?', '%', or NUL are kept, with the
+ * hex digits in uppercase.  Returns the new length or -3.
+ */
+static int
+hex_digit (unsigned c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+
+static int
+path_percent_decode (unsigned char *buf, int len)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    unsigned c;
+    int i, out, hi, lo;
+
+    out = 0;
+    for (i = 0; i < len; ++i)
+    {
+        if (buf[i] != '%')
+        {
+            buf[out++] = buf[i];
+            continue;
+        }
+        if (i + 2 >= len || (hi = hex_digit(buf[i + 1])) < 0
+                                    || (lo = hex_digit(buf[i + 2])) < 0)
+            return -3;
+        c = hi << 4 | lo;
+        if (c == '/' || c == '?' || c == '%' || c == '\0')
+        {
+            buf[out++] = '%';
+            buf[out++] = hex[c >> 4];
+            buf[out++] = hex[c & 0xF];
+        }
+        else
+            buf[out++] = c;
+        i += 2;
+    }
+
+    return out;
+}
+
+
+/* remove_dot_segments() of RFC 3986, Section 5.2.4, in place */
+static int
+path_remove_dots (unsigned char *buf, int len)
+{
+    unsigned char *in, *out, *const end = buf + len;
+    int n, up;
+
+    in = out = buf;
+    while (in < end)
+    {
+        n = end - in;
+        up = 0;
+        if (n >= 3 && 0 == memcmp(in, "../", 3))
+            in += 3;
+        else if (n >= 2 && 0 == memcmp(in, "./", 2))
+            in += 2;
+        else if (n >= 3 && 0 == memcmp(in, "/./", 3))
+            in += 2;
+        else if (n == 2 && 0 == memcmp(in, "/.", 2))
+            *++in = '/';
+        else if (n >= 4 && 0 == memcmp(in, "/../", 4))
+        {
+            in += 3;
+            up = 1;
+        }
+        else if (n == 3 && 0 == memcmp(in, "/..", 3))
+        {
+            in += 2;
+            *in = '/';
+            up = 1;
+        }
+        else if ((n == 1 && in[0] == '.')
+                                || (n == 2 && 0 == memcmp(in, "..", 2)))
+            in = end;
+        else
+            do
+                *out++ = *in++;
+            while (in < end && *in != '/');
+        if (up)
+        {
+            while (out > buf && out[-1] != '/')
+                --out;
+            if (out > buf)
+                --out;
+        }
+    }
+
+    return out - buf;
+}
+
+
+static int
+decode_path_ref (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    const unsigned char *q;
+    int len, path_len, new_len;
+
+    len = lshpack_dec_huff_decode(src, src_len, dst, dst_len);
+    if (len < 0)
+        return len;
+    q = memchr(dst, '?', len);
+    path_len = q ? q - dst : len;
+    new_len = path_percent_decode(dst, path_len);
+    if (new_len < 0)
+        return new_len;
+    new_len = path_remove_dots(dst, new_len);
+    memmove(dst + new_len, dst + path_len, len - path_len);
+    return new_len + len - path_len;
+}
+
+
+/* Crumb offsets of the last cookie decoded in cookie modes */
+#define MAX_CRUMBS 0x1000
+static unsigned s_crumbs[MAX_CRUMBS];
+static unsigned s_n_crumbs;
+
+
+static int
+decode_cookie (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    s_n_crumbs = MAX_CRUMBS;
+    return lshpack_dec_huff_decode_cookie(src, src_len, dst, dst_len,
+                                                    s_crumbs, &s_n_crumbs);
+}
+
+
+/* Decode the cookie and then find the "; " between crumbs */
+static int
+decode_cookie_split (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    const unsigned char *p, *end;
+    int len;
+
+    s_n_crumbs = 0;
+    len = lshpack_dec_huff_decode(src, src_len, dst, dst_len);
+    if (len <= 0)
+        return len;
+    s_crumbs[s_n_crumbs++] = 0;
+    end = dst + len;
+    for (p = dst; (p = memchr(p, ';', end - p)); )
+        if (++p < end && *p == ' ')
+        {
+            if (s_n_crumbs >= MAX_CRUMBS)
+                return -2;
+            s_crumbs[s_n_crumbs++] = p + 1 - dst;
+        }
+    return len;
+}
+
+
+/* Chunks in litespeed-stream are from 1 to this many bytes long */
+#define STREAM_MAX_CHUNK 256
+
+
+/* Decode the string in chunks of random sizes, as if it came in pieces.
+ * The sizes are the same in each run.
+ */
+static int
+decode_stream (const unsigned char *src, int src_len, unsigned char *dst,
+                                                                int dst_len)
+{
+    struct lshpack_huff_stream stream;
+    uint32_t rand;
+    int chunk, len, rv;
+
+    lshpack_dec_huff_stream_init(&stream);
+    rand = 1;
+    len = 0;
+    while (src_len > 0)
+    {
+        rand ^= rand << 13;     /* xorshift32 */
+        rand ^= rand >> 17;
+        rand ^= rand << 5;
+        chunk = 1 + rand % STREAM_MAX_CHUNK;
+        if (chunk > src_len)
+            chunk = src_len;
+        rv = lshpack_dec_huff_stream_decode(&stream, src, chunk, dst + len,
+                                                                dst_len - len);
+        if (rv < 0)
+            return rv;
+        len += rv;
+        src += chunk;
+        src_len -= chunk;
+    }
+
+    rv = lshpack_dec_huff_stream_finish(&stream, dst + len, dst_len - len);
+    return rv < 0 ? rv : len + rv;
+}
+
+
+/* The same with the whole string in one chunk */
+static int
+decode_stream_whole (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    struct lshpack_huff_stream stream;
+    int len, rv;
+
+    lshpack_dec_huff_stream_init(&stream);
+    len = lshpack_dec_huff_stream_decode(&stream, src, src_len, dst, dst_len);
+    if (len < 0)
+        return len;
+    rv = lshpack_dec_huff_stream_finish(&stream, dst + len, dst_len - len);
+    return rv < 0 ? rv : len + rv;
+}
+
+
+typedef int (*decode_f) (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+
+/* Decode the corpus by calling `decode_one' for each string */
+static int
+corpus_decode_each (decode_f decode_one, const unsigned char *src,
+                            int src_len, unsigned char *dst, int dst_len)
+{
+    unsigned i;
+    int rv, total;
+
+    if (s_corpus.in != src && 0 != corpus_parse(src, src_len, dst, dst_len))
+        return -1;
+
+    total = 0;
+    for (i = 0; i < s_corpus.count; ++i)
+    {
+        rv = decode_one(s_corpus.srcs[i], s_corpus.src_lens[i],
+                                    s_corpus.dsts[i], s_corpus.dst_lens[i]);
+        if (rv < 0)
+            return rv;
+        total += rv;
+    }
+
+    return total;
+}
+
+
+/* Decode every string in the corpus, valid or not, as for hostile-*.hpack.
+ * Returns the total length of the strings that are valid.
+ */
+static int
+corpus_decode_all (decode_f decode_one, const unsigned char *src,
+                            int src_len, unsigned char *dst, int dst_len)
+{
+    unsigned i;
+    int rv, total;
+
+    if (s_corpus.in != src && 0 != corpus_parse(src, src_len, dst, dst_len))
+        return -1;
+
+    total = 0;
+    for (i = 0; i < s_corpus.count; ++i)
+    {
+        rv = decode_one(s_corpus.srcs[i], s_corpus.src_lens[i],
+                                    s_corpus.dsts[i], s_corpus.dst_lens[i]);
+        if (rv > 0)
+            total += rv;
+    }
+
+    return total;
+}
+
+
+static int
+corpus_decode_loop (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(lshpack_dec_huff_decode, src, src_len,
+                                                            dst, dst_len);
+}
+
+
+static int
+corpus_decode_slack (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(lshpack_dec_huff_decode_slack, src, src_len,
+                                                            dst, dst_len);
+}
+
+
+static int
+corpus_validate (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(validate, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_decode_hash (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(decode_hash, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_decode_then_hash (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(decode_then_hash, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_match (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(match_or_decode, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_lookup (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(decode_lookup, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_decode_uint (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(decode_uint, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_decode_strtoull (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(decode_strtoull, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_decode_path (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(lshpack_dec_huff_decode_path, src, src_len,
+                                                            dst, dst_len);
+}
+
+
+static int
+corpus_decode_path_ref (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(decode_path_ref, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_decode_cookie (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(decode_cookie, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_decode_cookie_split (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_each(decode_cookie_split, src, src_len, dst,
+                                                                    dst_len);
+}
+
+
+static int
+corpus_decode_any (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_all(lshpack_dec_huff_decode, src, src_len, dst,
+                                                                    dst_len);
+}
+
+
+static int
+corpus_decode_bounded (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_all(lshpack_dec_huff_decode_bounded, src, src_len,
+                                                            dst, dst_len);
+}
+
+
+/* Decode the corpus as a header list: names and values in turn */
+static int
+corpus_decode_fields (decode_f decode_name, decode_f decode_value,
+        const unsigned char *src, int src_len, unsigned char *dst, int dst_len)
+{
+    unsigned i;
+    int rv, total;
+
+    if (s_corpus.in != src && 0 != corpus_parse(src, src_len, dst, dst_len))
+        return -1;
+
+    total = 0;
+    for (i = 0; i < s_corpus.count; ++i)
+    {
+        rv = (i & 1 ? decode_value : decode_name)(s_corpus.srcs[i],
+                s_corpus.src_lens[i], s_corpus.dsts[i], s_corpus.dst_lens[i]);
+        if (rv < 0)
+            return rv;
+        total += rv;
+    }
+
+    return total;
+}
+
+
+static int
+corpus_decode_class (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_fields(lshpack_dec_huff_decode_name,
+                lshpack_dec_huff_decode_value, src, src_len, dst, dst_len);
+}
+
+
+static int
+corpus_decode_scan (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_fields(decode_name_scan, decode_value_scan,
+                                            src, src_len, dst, dst_len);
+}
+
+
+typedef int (*batch_decode_f) (unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        unsigned char *const *dsts, const int *dst_lens, int *results);
+
+
+/* Decode the corpus using a function that takes all strings at once */
+static int
+corpus_decode_many (batch_decode_f decode_many, const unsigned char *src,
+                            int src_len, unsigned char *dst, int dst_len)
+{
+    unsigned i;
+    int total;
+
+    if (s_corpus.in != src && 0 != corpus_parse(src, src_len, dst, dst_len))
+        return -1;
+
+    if (0 != decode_many(s_corpus.count, s_corpus.srcs, s_corpus.src_lens,
+                            s_corpus.dsts, s_corpus.dst_lens, s_corpus.results))
+        return -1;
+
+    total = 0;
+    for (i = 0; i < s_corpus.count; ++i)
+        total += s_corpus.results[i];
+
+    return total;
+}
+
+
+static int
+corpus_decode_batch (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_many(lshpack_dec_huff_decode_batch, src, src_len,
+                                                            dst, dst_len);
+}
+
+
+static int
+corpus_decode_simd (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return corpus_decode_many(lshpack_dec_huff_decode_simd, src, src_len,
+                                                            dst, dst_len);
+}
+
+
+/* Views of the strings in arena modes */
+static struct lshpack_str_view s_views[MAX_CORPUS];
+
+
+/* Decode the corpus, a header list, into an arena in one call */
+static int
+corpus_decode_arena (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    struct lshpack_arena arena;
+    int rv;
+
+    if (s_corpus.in != src && 0 != corpus_parse(src, src_len, dst, dst_len))
+        return -1;
+
+    lshpack_arena_init(&arena, dst, dst_len);
+    rv = lshpack_dec_huff_decode_arena(&arena, s_corpus.count, s_corpus.srcs,
+                                                s_corpus.src_lens, s_views);
+    return rv < 0 ? rv : (int) arena.used;
+}
+
+
+/* The way it is done without an arena: decode each string into a scratch
+ * buffer of the worst-case size and copy it into storage from there.
+ */
+static int
+corpus_decode_arena_copy (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    static unsigned char scratch[0x4000];
+    unsigned i;
+    int len, used;
+
+    if (s_corpus.in != src && 0 != corpus_parse(src, src_len, dst, dst_len))
+        return -1;
+
+    used = 0;
+    for (i = 0; i < s_corpus.count; ++i)
+    {
+        len = lshpack_dec_huff_decode(s_corpus.srcs[i], s_corpus.src_lens[i],
+                                                    scratch, sizeof(scratch));
+        if (len < 0)
+            return len;
+        if (len > dst_len - used)
+            return -2;
+        memcpy(dst + used, scratch, len);
+        s_views[i].ptr = dst + used;
+        s_views[i].len = len;
+        used += len;
+    }
+
+    return used;
+}
+
+
 int
 main (int argc, char **argv)
 {
     size_t in_sz;
     int count, i, rv;
+    unsigned multi_bits = 0;
     FILE *in;
     int (*decode)(const unsigned char *, int, unsigned char *, int);
-    unsigned char in_buf[0x1000];
-    unsigned char out_buf[0x4000];
+    static unsigned char in_buf[0x10000];
+    static unsigned char out_buf[0x20000];
 
     if (argc != 4)
     {
         fprintf(stderr,
                 "Usage: %s $file $count $mode\n"
                 "\n"
-                "  $mode is either litespeed, litespeed-full, or nginx\n", argv[0]);
+                "  $mode is either litespeed, litespeed-full, litespeed-2level,\n"
+                "    litespeed-canonical, litespeed-fsm8, litespeed-multi{12,14,16,20,22},\n"
+                "    litespeed-slack, litespeed-padded, litespeed-parallel,\n"
+                "    litespeed-validate, litespeed-count, litespeed-copy,\n"
+                "    litespeed-count-decode, litespeed-value, litespeed-value-scan,\n"
+                "    litespeed-hash, litespeed-hash-after, litespeed-cookie,\n"
+                "    litespeed-cookie-split, litespeed-stream, litespeed-stream-whole,\n"
+                "    litespeed-bounded, or nginx\n"
+                "\n"
+                "  Corpus modes, which read output of mk-corpus, are litespeed-loop,\n"
+                "    litespeed-slack-loop, litespeed-validate-loop, litespeed-fields,\n"
+                "    litespeed-fields-scan, litespeed-hash-loop, litespeed-hash-after-loop,\n"
+                "    litespeed-match-loop, litespeed-lookup-loop, litespeed-uint-loop,\n"
+                "    litespeed-strtoull-loop, litespeed-path-loop, litespeed-path-ref-loop,\n"
+                "    litespeed-cookie-loop, litespeed-cookie-split-loop, litespeed-any-loop,\n"
+                "    litespeed-bounded-loop, litespeed-arena, litespeed-arena-copy,\n"
+                "    litespeed-batch, and litespeed-simd\n",
+                argv[0]);
         exit(EXIT_FAILURE);
     }
 
@@ -43,18 +971,174 @@ main (int argc, char **argv)
         decode = lshpack_dec_huff_decode;
     else if (strcasecmp(argv[3], "litespeed-full") == 0)
         decode = lshpack_dec_huff_decode_full;
+    else if (strcasecmp(argv[3], "litespeed-2level") == 0)
+        decode = lshpack_dec_huff_decode_2level;
+    else if (strcasecmp(argv[3], "litespeed-canonical") == 0)
+        decode = lshpack_dec_huff_decode_canonical;
+    else if (strcasecmp(argv[3], "litespeed-fsm8") == 0)
+        decode = lshpack_dec_huff_decode_fsm8;
+    else if (strcasecmp(argv[3], "litespeed-multi12") == 0)
+    {
+        decode = lshpack_dec_huff_decode_multi12;
+        multi_bits = 12;
+    }
+    else if (strcasecmp(argv[3], "litespeed-multi14") == 0)
+    {
+        decode = lshpack_dec_huff_decode_multi14;
+        multi_bits = 14;
+    }
+    else if (strcasecmp(argv[3], "litespeed-multi16") == 0)
+    {
+        decode = lshpack_dec_huff_decode_multi16;
+        multi_bits = 16;
+    }
+    else if (strcasecmp(argv[3], "litespeed-multi20") == 0)
+    {
+        decode = lshpack_dec_huff_decode_multi20;
+        multi_bits = 20;
+    }
+    else if (strcasecmp(argv[3], "litespeed-multi22") == 0)
+    {
+        decode = lshpack_dec_huff_decode_multi22;
+        multi_bits = 22;
+    }
+    else if (strcasecmp(argv[3], "litespeed-slack") == 0)
+        decode = lshpack_dec_huff_decode_slack;
+    else if (strcasecmp(argv[3], "litespeed-padded") == 0)
+        decode = lshpack_dec_huff_decode_padded;
+    else if (strcasecmp(argv[3], "litespeed-parallel") == 0)
+        decode = lshpack_dec_huff_decode_parallel;
+    else if (strcasecmp(argv[3], "litespeed-validate") == 0)
+        decode = validate;
+    else if (strcasecmp(argv[3], "litespeed-count") == 0)
+        decode = count_only;
+    else if (strcasecmp(argv[3], "litespeed-copy") == 0)
+        decode = decode_copy;
+    else if (strcasecmp(argv[3], "litespeed-count-decode") == 0)
+        decode = count_decode;
+    else if (strcasecmp(argv[3], "litespeed-value") == 0)
+        decode = lshpack_dec_huff_decode_value;
+    else if (strcasecmp(argv[3], "litespeed-value-scan") == 0)
+        decode = decode_value_scan;
+    else if (strcasecmp(argv[3], "litespeed-hash") == 0)
+        decode = decode_hash;
+    else if (strcasecmp(argv[3], "litespeed-hash-after") == 0)
+        decode = decode_then_hash;
+    else if (strcasecmp(argv[3], "litespeed-cookie") == 0)
+        decode = decode_cookie;
+    else if (strcasecmp(argv[3], "litespeed-cookie-split") == 0)
+        decode = decode_cookie_split;
+    else if (strcasecmp(argv[3], "litespeed-stream") == 0)
+        decode = decode_stream;
+    else if (strcasecmp(argv[3], "litespeed-stream-whole") == 0)
+        decode = decode_stream_whole;
+    else if (strcasecmp(argv[3], "litespeed-bounded") == 0)
+        decode = lshpack_dec_huff_decode_bounded;
     else if (strcasecmp(argv[3], "nginx") == 0)
         decode = ngx_http_v2_huff_decode;
+    else if (strcasecmp(argv[3], "litespeed-loop") == 0)
+        decode = corpus_decode_loop;
+    else if (strcasecmp(argv[3], "litespeed-slack-loop") == 0)
+        decode = corpus_decode_slack;
+    else if (strcasecmp(argv[3], "litespeed-validate-loop") == 0)
+        decode = corpus_validate;
+    else if (strcasecmp(argv[3], "litespeed-fields") == 0)
+        decode = corpus_decode_class;
+    else if (strcasecmp(argv[3], "litespeed-fields-scan") == 0)
+        decode = corpus_decode_scan;
+    else if (strcasecmp(argv[3], "litespeed-hash-loop") == 0)
+        decode = corpus_decode_hash;
+    else if (strcasecmp(argv[3], "litespeed-hash-after-loop") == 0)
+        decode = corpus_decode_then_hash;
+    else if (strcasecmp(argv[3], "litespeed-match-loop") == 0)
+        decode = corpus_match;
+    else if (strcasecmp(argv[3], "litespeed-lookup-loop") == 0)
+        decode = corpus_lookup;
+    else if (strcasecmp(argv[3], "litespeed-uint-loop") == 0)
+        decode = corpus_decode_uint;
+    else if (strcasecmp(argv[3], "litespeed-strtoull-loop") == 0)
+        decode = corpus_decode_strtoull;
+    else if (strcasecmp(argv[3], "litespeed-path-loop") == 0)
+        decode = corpus_decode_path;
+    else if (strcasecmp(argv[3], "litespeed-path-ref-loop") == 0)
+        decode = corpus_decode_path_ref;
+    else if (strcasecmp(argv[3], "litespeed-cookie-loop") == 0)
+        decode = corpus_decode_cookie;
+    else if (strcasecmp(argv[3], "litespeed-cookie-split-loop") == 0)
+        decode = corpus_decode_cookie_split;
+    else if (strcasecmp(argv[3], "litespeed-any-loop") == 0)
+        decode = corpus_decode_any;
+    else if (strcasecmp(argv[3], "litespeed-bounded-loop") == 0)
+        decode = corpus_decode_bounded;
+    else if (strcasecmp(argv[3], "litespeed-arena") == 0)
+        decode = corpus_decode_arena;
+    else if (strcasecmp(argv[3], "litespeed-arena-copy") == 0)
+        decode = corpus_decode_arena_copy;
+    else if (strcasecmp(argv[3], "litespeed-batch") == 0)
+        decode = corpus_decode_batch;
+    else if (strcasecmp(argv[3], "litespeed-simd") == 0)
+        decode = corpus_decode_simd;
     else
     {
         fprintf(stderr, "Mode `%s' is invalid.  Specify either one of the following:\n"
             "  litespeed\n"
             "  litespeed-full\n"
+            "  litespeed-2level\n"
+            "  litespeed-canonical\n"
+            "  litespeed-fsm8\n"
+            "  litespeed-multi12\n"
+            "  litespeed-multi14\n"
+            "  litespeed-multi16\n"
+            "  litespeed-multi20\n"
+            "  litespeed-multi22\n"
+            "  litespeed-slack\n"
+            "  litespeed-padded\n"
+            "  litespeed-parallel\n"
+            "  litespeed-validate\n"
+            "  litespeed-count\n"
+            "  litespeed-copy\n"
+            "  litespeed-count-decode\n"
+            "  litespeed-value\n"
+            "  litespeed-value-scan\n"
+            "  litespeed-hash\n"
+            "  litespeed-hash-after\n"
+            "  litespeed-cookie\n"
+            "  litespeed-cookie-split\n"
+            "  litespeed-stream\n"
+            "  litespeed-stream-whole\n"
+            "  litespeed-bounded\n"
             "  nginx\n"
+            "  litespeed-loop\n"
+            "  litespeed-slack-loop\n"
+            "  litespeed-validate-loop\n"
+            "  litespeed-fields\n"
+            "  litespeed-fields-scan\n"
+            "  litespeed-hash-loop\n"
+            "  litespeed-hash-after-loop\n"
+            "  litespeed-match-loop\n"
+            "  litespeed-lookup-loop\n"
+            "  litespeed-uint-loop\n"
+            "  litespeed-strtoull-loop\n"
+            "  litespeed-path-loop\n"
+            "  litespeed-path-ref-loop\n"
+            "  litespeed-cookie-loop\n"
+            "  litespeed-cookie-split-loop\n"
+            "  litespeed-any-loop\n"
+            "  litespeed-bounded-loop\n"
+            "  litespeed-arena\n"
+            "  litespeed-arena-copy\n"
+            "  litespeed-batch\n"
+            "  litespeed-simd\n"
             , argv[3]);
         exit(EXIT_FAILURE);
     }
 
+    if (multi_bits && 0 != lshpack_dec_huff_multi_init(multi_bits))
+    {
+        fprintf(stderr, "cannot build %u-bit decoder table\n", multi_bits);
+        exit(EXIT_FAILURE);
+    }
+
     in = fopen(argv[1], "rb");
     if (!in)
     {
@@ -62,8 +1146,9 @@ main (int argc, char **argv)
         exit(EXIT_FAILURE);
     }
 
-    in_sz = fread(in_buf, 1, sizeof(in_buf), in);
-    if (in_sz == 0 || in_sz == sizeof(in_buf))
+    /* Leave eight bytes after the input for litespeed-padded */
+    in_sz = fread(in_buf, 1, sizeof(in_buf) - 8, in);
+    if (in_sz == 0 || in_sz == sizeof(in_buf) - 8)
     {
         fprintf(stderr, "input file is either too short or too long\n");
         exit(EXIT_FAILURE);
@@ -0,0 +1,728 @@
+/* gen-tables: generate auxiliary decoder tables from the RFC 7541 code.
+ *
+ * The tables are derived from encode_table in litespeed-table.h and are
+ * written to the standard output as a C header.  The Makefile uses this
+ * program to produce the *-table.h files that are not checked in.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+
+/* Flags in decode_tables, as in litespeed.c */
+enum
+{
+    HPACK_HUFFMAN_FLAG_ACCEPTED = 0x01,
+    HPACK_HUFFMAN_FLAG_SYM = 0x02,
+    HPACK_HUFFMAN_FLAG_FAIL = 0x04,
+};
+
+/* Each code longer than 16 bits begins with this many 1 bits */
+#define LONG_PREFIX 15
+/* The second-level table is indexed by this many bits after the prefix */
+#define LONG_L2_BITS 8
+#define LONG_L2_END (LONG_PREFIX + LONG_L2_BITS)
+
+struct long_el
+{
+    unsigned len, sym, width, base;
+};
+
+
+static void
+gen_2level (void)
+{
+    struct long_el l2[1 << LONG_L2_BITS], l3[0x100];
+    unsigned sym, idx, pfx, len, width, n_l3, i;
+    uint32_t code;
+
+    memset(l2, 0, sizeof(l2));
+    memset(l3, 0, sizeof(l3));
+
+    /* Pass 1: leaves in the second-level table and widths of subtables */
+    for (sym = 0; sym < 257; ++sym)
+    {
+        code = encode_table[sym].code;
+        len = encode_table[sym].bits;
+        if (len <= 16)
+            continue;
+        if (len <= LONG_L2_END)
+        {
+            idx = (code << (LONG_L2_END - len)) & ((1 << LONG_L2_BITS) - 1);
+            for (i = 0; i < 1u << (LONG_L2_END - len); ++i)
+            {
+                l2[idx + i].len = len;
+                l2[idx + i].sym = sym;
+            }
+        }
+        else
+        {
+            idx = (code >> (len - LONG_L2_END)) & ((1 << LONG_L2_BITS) - 1);
+            if (l2[idx].width < len - LONG_L2_END)
+                l2[idx].width = len - LONG_L2_END;
+        }
+    }
+
+    /* Pass 2: lay out subtables */
+    n_l3 = 0;
+    for (idx = 0; idx < 1 << LONG_L2_BITS; ++idx)
+        if (l2[idx].width)
+        {
+            l2[idx].base = n_l3;
+            n_l3 += 1 << l2[idx].width;
+        }
+    if (n_l3 > sizeof(l3) / sizeof(l3[0]))
+    {
+        fprintf(stderr, "third-level table is too large: %u\n", n_l3);
+        exit(EXIT_FAILURE);
+    }
+
+    /* Pass 3: leaves in the third-level tables.  EOS is left as zero. */
+    for (sym = 0; sym < 256; ++sym)
+    {
+        code = encode_table[sym].code;
+        len = encode_table[sym].bits;
+        if (len <= LONG_L2_END)
+            continue;
+        pfx = (code >> (len - LONG_L2_END)) & ((1 << LONG_L2_BITS) - 1);
+        width = l2[pfx].width;
+        idx = l2[pfx].base
+            + ((code << (width - (len - LONG_L2_END))) & ((1 << width) - 1));
+        for (i = 0; i < 1u << (width - (len - LONG_L2_END)); ++i)
+        {
+            l3[idx + i].len = len;
+            l3[idx + i].sym = sym;
+        }
+    }
+
+    printf(
+"/* Generated by `gen-tables 2level'; do not edit. */\n"
+"\n"
+"/* Codes longer than 16 bits all start with %u 1 bits.  The next %u bits\n"
+" * index hdec_long2.  An entry with non-zero width points to a subtable at\n"
+" * hdec_long3[base] indexed by the following `width' bits.  Otherwise, it\n"
+" * is a leaf: `len' is the total length of the code, zero for EOS.\n"
+" */\n"
+"#define HDEC_LONG_PREFIX %u\n"
+"#define HDEC_LONG_L2_BITS %u\n"
+"\n"
+"struct hdec_long { uint8_t len, sym, width, base; };\n"
+"\n", LONG_PREFIX, LONG_L2_BITS, LONG_PREFIX, LONG_L2_BITS);
+
+    printf("static const struct hdec_long hdec_long2[%u] =\n{\n",
+                                                        1 << LONG_L2_BITS);
+    for (idx = 0; idx < 1 << LONG_L2_BITS; ++idx)
+        printf("/* %3u */ { %2u, %3u, %u, %3u },\n", idx, l2[idx].len,
+                            l2[idx].sym, l2[idx].width, l2[idx].base);
+    printf("};\n\n");
+
+    printf("static const struct hdec_long hdec_long3[%u] =\n{\n", n_l3);
+    for (idx = 0; idx < n_l3; ++idx)
+        printf("/* %3u */ { %2u, %3u, 0, 0 },\n", idx, l3[idx].len,
+                                                            l3[idx].sym);
+    printf("};\n");
+}
+
+
+/* Canonical decoding: symbols sorted by code length, a base per length,
+ * and, for each count of leading 1 bits, the range of lengths codes with
+ * that many leading 1 bits can have.
+ */
+#define CANON_MAX_ONES 30
+
+static void
+gen_canonical (void)
+{
+    unsigned sorted[257], n_sorted, len, sym, k, i, ones;
+    unsigned min_len[CANON_MAX_ONES + 1], max_len[CANON_MAX_ONES + 1];
+    uint32_t first_code[32], lim[2];
+    int32_t base[32];
+
+    n_sorted = 0;
+    memset(first_code, 0, sizeof(first_code));
+    memset(base, 0, sizeof(base));
+    for (len = 1; len <= 30; ++len)
+        for (sym = 0; sym < 257; ++sym)
+            if (encode_table[sym].bits == (int) len)
+            {
+                if (n_sorted == 0 || encode_table[sorted[n_sorted - 1]].bits
+                                                                < (int) len)
+                {
+                    first_code[len] = encode_table[sym].code;
+                    base[len] = (int32_t) n_sorted - (int32_t) first_code[len];
+                }
+                sorted[n_sorted++] = sym;
+            }
+
+    for (k = 0; k <= CANON_MAX_ONES; ++k)
+    {
+        min_len[k] = 32;
+        max_len[k] = 0;
+    }
+    for (sym = 0; sym < 257; ++sym)
+    {
+        len = encode_table[sym].bits;
+        for (ones = 0; ones < len
+                && (encode_table[sym].code >> (len - 1 - ones) & 1); ++ones)
+            ;
+        if (min_len[ones] > len)
+            min_len[ones] = len;
+        if (max_len[ones] < len)
+            max_len[ones] = len;
+    }
+
+    printf(
+"/* Generated by `gen-tables canonical'; do not edit. */\n"
+"\n"
+"/* The RFC 7541 code is canonical.  A code with k leading 1 bits is\n"
+" * between hdec_canon_len0[k] and hdec_canon_len0[k] + 2 bits long: one\n"
+" * bit longer for each limit in hdec_canon_lim[k] that the left-aligned\n"
+" * 32-bit window is at or above.  The symbol is then\n"
+" *\n"
+" *   hdec_canon_syms[ (window >> (32 - len)) + hdec_canon_base[len] ]\n"
+" *\n"
+" * Thirty leading 1 bits is EOS.\n"
+" */\n"
+"#define HDEC_CANON_MAX_ONES %u\n"
+"\n", CANON_MAX_ONES);
+
+    printf("static const uint8_t hdec_canon_len0[%u] =\n{\n",
+                                                        CANON_MAX_ONES + 1);
+    for (k = 0; k <= CANON_MAX_ONES; ++k)
+    {
+        if (max_len[k] - min_len[k] > 2)
+        {
+            fprintf(stderr, "%u leading 1s: too many lengths\n", k);
+            exit(EXIT_FAILURE);
+        }
+        printf("    %2u,    /* %2u */\n", min_len[k], k);
+    }
+    printf("};\n\n");
+
+    printf("static const uint32_t hdec_canon_lim[%u][2] =\n{\n",
+                                                        CANON_MAX_ONES + 1);
+    for (k = 0; k <= CANON_MAX_ONES; ++k)
+    {
+        for (i = 0; i < 2; ++i)
+            if (k < CANON_MAX_ONES && min_len[k] + i + 1 <= max_len[k])
+            {
+                len = min_len[k] + i + 1;
+                if (!first_code[len])
+                {
+                    fprintf(stderr, "there are no %u-bit codes\n", len);
+                    exit(EXIT_FAILURE);
+                }
+                lim[i] = first_code[len] << (32 - len);
+            }
+            else
+                lim[i] = 0xFFFFFFFF;
+        printf("    { 0x%08X, 0x%08X, },    /* %2u */\n", lim[0], lim[1], k);
+    }
+    printf("};\n\n");
+
+    printf("static const int32_t hdec_canon_base[31] =\n{\n");
+    for (len = 0; len <= 30; ++len)
+        printf("    %11d,    /* %2u */\n", base[len], len);
+    printf("};\n\n");
+
+    printf("static const uint8_t hdec_canon_syms[256] =\n{\n");
+    for (i = 0; i < 256; ++i)
+        printf("%s%3u,%s", i % 8 ? " " : "    ", sorted[i],
+                                                    i % 8 == 7 ? "\n" : "");
+    printf("};\n");
+}
+
+
+/* Byte-indexed FSM: two steps of the 4-bit FSM in decode_tables composed
+ * into one.  Each step emits at most one symbol, as no code is shorter
+ * than 5 bits.
+ */
+#define FSM8_NSYM_SHIFT 4
+
+static void
+gen_fsm8 (void)
+{
+    unsigned state, byte, i, flags, nsym;
+    uint8_t syms[2];
+    struct decode_el el;
+
+    printf(
+"/* Generated by `gen-tables fsm8'; do not edit. */\n"
+"\n"
+"/* hdec_fsm8[state][byte] is the 4-bit FSM in decode_tables stepped over\n"
+" * the high and then the low nibble of `byte'.  The entry holds the new\n"
+" * state, the symbols emitted -- their number is in the high bits of\n"
+" * `flags' -- and whether the string may end there.\n"
+" */\n"
+"#define HDEC_FSM8_ACCEPTED 0x01\n"
+"#define HDEC_FSM8_FAIL 0x04\n"
+"#define HDEC_FSM8_NSYM_SHIFT %u\n"
+"\n"
+"struct hdec_fsm8 { uint8_t state, flags, sym[2]; };\n"
+"\n"
+"static const struct hdec_fsm8 hdec_fsm8[256][256] =\n{\n",
+                                                        FSM8_NSYM_SHIFT);
+
+    for (state = 0; state < 256; ++state)
+    {
+        printf("    /* %u */\n    {\n", state);
+        for (byte = 0; byte < 256; ++byte)
+        {
+            nsym = 0;
+            flags = 0;
+            syms[0] = syms[1] = 0;
+            el.state = state;
+            for (i = 0; i < 2; ++i)
+            {
+                el = decode_tables[el.state][i ? byte & 0xF : byte >> 4];
+                if (el.flags & HPACK_HUFFMAN_FLAG_FAIL)
+                {
+                    flags = HPACK_HUFFMAN_FLAG_FAIL;
+                    nsym = 0;
+                    el.state = 0;
+                    break;
+                }
+                if (el.flags & HPACK_HUFFMAN_FLAG_SYM)
+                    syms[nsym++] = el.sym;
+                flags = el.flags & HPACK_HUFFMAN_FLAG_ACCEPTED;
+            }
+            printf("        { %3u, 0x%02X, { %3u, %3u, }, },\n", el.state,
+                    flags | (nsym << FSM8_NSYM_SHIFT), syms[0], syms[1]);
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+}
+
+
+/* Character classes of symbols, OR-ed together by the decoders in
+ * litespeed-class.c.  ':' is not counted as a non-token character; it
+ * has a class of its own, so that pseudo-header names can be told apart.
+ */
+enum
+{
+    CLASS_UPPER     = 0x01,
+    CLASS_FORBIDDEN = 0x02,
+    CLASS_NONTOKEN  = 0x04,
+    CLASS_OBS_TEXT  = 0x08,
+    CLASS_COLON     = 0x10,
+};
+
+
+static unsigned
+sym_class (unsigned sym)
+{
+    unsigned class;
+
+    class = 0;
+    if (sym >= 'A' && sym <= 'Z')
+        class |= CLASS_UPPER;
+    if (sym == '\0' || sym == '\r' || sym == '\n')
+        class |= CLASS_FORBIDDEN;
+    if (sym >= 0x80)
+        class |= CLASS_OBS_TEXT;
+    if (sym == ':')
+        class |= CLASS_COLON;
+    else if (!((sym >= '0' && sym <= '9') || (sym >= 'a' && sym <= 'z')
+                || (sym >= 'A' && sym <= 'Z')
+                || (sym && strchr("!#$%&'*+-.^_`|~", sym))))
+        class |= CLASS_NONTOKEN;
+    return class;
+}
+
+
+static void
+gen_class (void)
+{
+    unsigned sym, idx, class, i;
+
+    printf(
+"/* Generated by `gen-tables class'; do not edit. */\n"
+"\n"
+"/* Character classes: hdec_sym_class[sym] is the class of a symbol and\n"
+" * hdec_class[idx] is the union of the classes of the symbols that\n"
+" * hdecs[idx] emits.  Token characters are those of RFC 9110, Section\n"
+" * 5.6.2; ':' is not one, but it is not counted as HDEC_CLASS_NONTOKEN.\n"
+" */\n"
+"#define HDEC_CLASS_UPPER 0x%02X\n"
+"#define HDEC_CLASS_FORBIDDEN 0x%02X\n"
+"#define HDEC_CLASS_NONTOKEN 0x%02X\n"
+"#define HDEC_CLASS_OBS_TEXT 0x%02X\n"
+"#define HDEC_CLASS_COLON 0x%02X\n"
+"\n", CLASS_UPPER, CLASS_FORBIDDEN, CLASS_NONTOKEN, CLASS_OBS_TEXT,
+                                                                CLASS_COLON);
+
+    printf("static const uint8_t hdec_sym_class[256] =\n{\n");
+    for (sym = 0; sym < 256; ++sym)
+        printf("%s0x%02X,%s", sym % 8 ? " " : "    ", sym_class(sym),
+                                                sym % 8 == 7 ? "\n" : "");
+    printf("};\n\n");
+
+    printf("static const uint8_t hdec_class[65536] =\n{\n");
+    for (idx = 0; idx < 65536; ++idx)
+    {
+        class = 0;
+        for (i = 0; i < (hdecs[idx].lens & 3u); ++i)
+            class |= sym_class(hdecs[idx].out[i]);
+        printf("%s0x%02X,%s", idx % 16 ? " " : "    ", class,
+                                                idx % 16 == 15 ? "\n" : "");
+    }
+    printf("};\n");
+}
+
+
+/* Table for decoding decimal numbers: two digits per lookup.  The digit
+ * codes are five or six bits long, so DIGITS_BITS bits always hold two.
+ */
+#define DIGITS_BITS 12
+
+static void
+gen_digits (void)
+{
+    unsigned idx, pos, n, value, d;
+
+    printf(
+"/* Generated by `gen-tables digits'; do not edit. */\n"
+"\n"
+"/* hdec_digits[idx] decodes the digits at the start of the %u-bit index:\n"
+" * `lens' is the number of bits they take shifted left by two, plus the\n"
+" * number of digits, and `value' is their value.  If the first code is\n"
+" * not that of a digit, `lens' is zero.\n"
+" */\n"
+"#define HDEC_DIGITS_BITS %u\n"
+"\n"
+"struct hdec_digits { uint8_t lens, value; };\n"
+"\n"
+"static const struct hdec_digits hdec_digits[%u] =\n{\n",
+                        DIGITS_BITS, DIGITS_BITS, 1 << DIGITS_BITS);
+
+    for (idx = 0; idx < 1 << DIGITS_BITS; ++idx)
+    {
+        pos = 0;
+        n = 0;
+        value = 0;
+        while (n < 2)
+        {
+            for (d = '0'; d <= '9'; ++d)
+                if (pos + encode_table[d].bits <= DIGITS_BITS
+                    && ((idx >> (DIGITS_BITS - pos - encode_table[d].bits))
+                            & ((1u << encode_table[d].bits) - 1))
+                                                    == encode_table[d].code)
+                    break;
+            if (d > '9')
+                break;
+            pos += encode_table[d].bits;
+            value = value * 10 + d - '0';
+            ++n;
+        }
+        printf("    { %2u << 2 | %u, %2u, },\n", pos, n, value);
+    }
+    printf("};\n");
+}
+
+
+/* Print the bitmap `name' of `hdecs' entries that emit any of the
+ * characters in `syms'.  `desc' names them in the comment.
+ */
+static void
+gen_sym_bitmap (const char *gen, const char *name, const char *syms,
+                                                            const char *desc)
+{
+    uint8_t bits[65536 / 8];
+    unsigned idx, i;
+
+    memset(bits, 0, sizeof(bits));
+    for (idx = 0; idx < 65536; ++idx)
+        for (i = 0; i < (hdecs[idx].lens & 3u); ++i)
+            if (hdecs[idx].out[i] && strchr(syms, hdecs[idx].out[i]))
+                bits[idx / 8] |= 1 << idx % 8;
+
+    printf(
+"/* Generated by `gen-tables %s'; do not edit. */\n"
+"\n"
+"/* Bit idx %% 8 of %s[idx / 8] is set if hdecs[idx] emits\n"
+" * %s.\n"
+" */\n"
+"static const uint8_t %s[%u] =\n{\n", gen, name, desc, name, 65536 / 8);
+    for (i = 0; i < 65536 / 8; ++i)
+        printf("%s0x%02X,%s", i % 12 ? " " : "    ", bits[i],
+                                                i % 12 == 11 ? "\n" : "");
+    printf("\n};\n");
+}
+
+
+/* Bitmap of `hdecs' entries that emit a symbol the :path decoder in
+ * litespeed-path.c handles one at a time.
+ */
+static void
+gen_path (void)
+{
+    gen_sym_bitmap("path", "hdec_path_special", "%/?", "'%', '/', or '?'");
+}
+
+
+/* Bitmap of `hdecs' entries that emit ';', which separates cookie crumbs,
+ * for litespeed-cookie.c.
+ */
+static void
+gen_cookie (void)
+{
+    gen_sym_bitmap("cookie", "hdec_cookie_semi", ";", "';'");
+}
+
+
+/* Strings for the encoded-domain dictionary in litespeed-dict.c: the
+ * names and values of the HPACK static table (RFC 7541, Appendix A) and
+ * other common header names and values.
+ */
+static const char *const dict_strs[] =
+{
+    ":authority", ":method", ":path", ":scheme", ":status",
+    "accept-charset", "accept-encoding", "accept-language", "accept-ranges",
+    "accept", "access-control-allow-origin", "age", "allow",
+    "authorization", "cache-control", "content-disposition",
+    "content-encoding", "content-language", "content-length",
+    "content-location", "content-range", "content-type", "cookie", "date",
+    "etag", "expect", "expires", "from", "host", "if-match",
+    "if-modified-since", "if-none-match", "if-range",
+    "if-unmodified-since", "last-modified", "link", "location",
+    "max-forwards", "proxy-authenticate", "proxy-authorization", "range",
+    "referer", "refresh", "retry-after", "server", "set-cookie",
+    "strict-transport-security", "transfer-encoding", "user-agent", "vary",
+    "via", "www-authenticate",
+    "GET", "POST", "/", "/index.html", "http", "https", "200", "204", "206",
+    "304", "400", "404", "500", "gzip, deflate",
+    "access-control-allow-credentials", "access-control-allow-headers",
+    "access-control-allow-methods", "access-control-expose-headers",
+    "access-control-request-headers", "access-control-request-method",
+    "alt-svc", "content-security-policy", "early-data", "expect-ct",
+    "forwarded", "origin", "purpose", "sec-ch-ua", "sec-ch-ua-mobile",
+    "sec-ch-ua-platform", "sec-fetch-dest", "sec-fetch-mode",
+    "sec-fetch-site", "sec-fetch-user", "te", "timing-allow-origin",
+    "upgrade-insecure-requests", "x-content-type-options",
+    "x-forwarded-for", "x-frame-options", "x-requested-with",
+    "x-xss-protection", "pragma", "priority",
+    "gzip, deflate, br", "gzip", "br", "deflate", "identity", "trailers",
+    "*/*", "*", "bytes", "no-cache", "no-store", "private", "public",
+    "max-age=0", "max-age=31536000", "max-age=31536000; includeSubDomains",
+    "nosniff", "DENY", "SAMEORIGIN", "1; mode=block", "?0", "?1", "1",
+    "navigate", "cors", "no-cors", "same-origin", "same-site", "cross-site",
+    "none", "document", "empty", "script", "style", "image",
+    "text/html", "text/html; charset=utf-8", "text/html; charset=UTF-8",
+    "text/plain", "text/css", "text/javascript", "application/json",
+    "application/javascript", "application/x-www-form-urlencoded",
+    "image/png", "image/jpeg", "image/gif", "image/webp", "image/svg+xml",
+    "en-US,en;q=0.9", "u=0, i", "u=1", "HEAD", "PUT", "DELETE", "OPTIONS",
+    "301", "302", "403", "503", "LiteSpeed", "hit", "miss",
+};
+
+#define DICT_COUNT (sizeof(dict_strs) / sizeof(dict_strs[0]))
+#define DICT_BITS 10
+
+
+static unsigned
+dict_encode (const char *str, unsigned char *dst)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *src;
+    uint64_t bits = 0;
+    unsigned bits_used = 0;
+
+    for (src = (const unsigned char *) str; *src; ++src)
+    {
+        bits <<= encode_table[*src].bits;
+        bits |= encode_table[*src].code;
+        bits_used += encode_table[*src].bits;
+        while (bits_used >= 8)
+        {
+            bits_used -= 8;
+            *dst++ = bits >> bits_used;
+        }
+    }
+
+    if (bits_used)
+        *dst++ = (bits << (8 - bits_used)) | (0xFF >> bits_used);   /* EOS */
+
+    return dst - orig_dst;
+}
+
+
+/* The key of a string: its length and its first and last four bytes.
+ * This must match dict_key() in litespeed-dict.c.
+ */
+static uint64_t
+dict_key (const unsigned char *s, unsigned len)
+{
+    uint32_t a, b;
+
+    if (len >= 4)
+    {
+        memcpy(&a, s, 4);
+        memcpy(&b, s + len - 4, 4);
+    }
+    else if (len > 0)
+    {
+        a = s[0] | s[len >> 1] << 8 | s[len - 1] << 16;
+        b = 0;
+    }
+    else
+        a = b = 0;
+    return ((uint64_t) a << 32 | b) ^ len;
+}
+
+
+/* Find a multiplier that sends each key to a slot of its own.  With about
+ * six slots per string, one in a few hundred thousand multipliers does;
+ * the search takes a fraction of a second.
+ */
+static uint64_t
+dict_seed (const uint64_t *keys, uint8_t *slots)
+{
+    uint64_t seed;
+    unsigned tries, i, slot;
+
+    seed = 0x9E3779B97F4A7C15ull;
+    for (tries = 0; tries < 10000000; ++tries)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        seed |= 1;
+        memset(slots, 0, 1 << DICT_BITS);
+        for (i = 0; i < DICT_COUNT; ++i)
+        {
+            slot = (keys[i] * seed) >> (64 - DICT_BITS);
+            if (slots[slot])
+                break;
+            slots[slot] = i + 1;
+        }
+        if (i == DICT_COUNT)
+            return seed;
+    }
+
+    fprintf(stderr, "cannot find a perfect hash for the dictionary\n");
+    exit(EXIT_FAILURE);
+}
+
+
+static void
+gen_dict (void)
+{
+    static unsigned char enc[DICT_COUNT][256];
+    uint64_t enc_keys[DICT_COUNT], plain_keys[DICT_COUNT];
+    uint64_t enc_seed, plain_seed;
+    uint8_t enc_slots[1 << DICT_BITS], plain_slots[1 << DICT_BITS];
+    unsigned enc_lens[DICT_COUNT], max_enc, i, j;
+    const char *p;
+
+    if (DICT_COUNT > 255)
+    {
+        fprintf(stderr, "dictionary is too large\n");
+        exit(EXIT_FAILURE);
+    }
+
+    max_enc = 0;
+    for (i = 0; i < DICT_COUNT; ++i)
+    {
+        enc_lens[i] = dict_encode(dict_strs[i], enc[i]);
+        if (max_enc < enc_lens[i])
+            max_enc = enc_lens[i];
+        enc_keys[i] = dict_key(enc[i], enc_lens[i]);
+        plain_keys[i] = dict_key((const unsigned char *) dict_strs[i],
+                                                    strlen(dict_strs[i]));
+    }
+    enc_seed = dict_seed(enc_keys, enc_slots);
+    plain_seed = dict_seed(plain_keys, plain_slots);
+
+    printf(
+"/* Generated by `gen-tables dict'; do not edit. */\n"
+"\n"
+"/* A dictionary of common header names and values, each with its Huffman\n"
+" * encoding, and two perfect hash tables: one for the encoded strings and\n"
+" * one for the strings themselves.  A key, see dict_key(), multiplied by\n"
+" * the seed gives the slot in its top HDEC_DICT_BITS bits.  Slots hold the\n"
+" * index in hdec_dict plus one, or zero.\n"
+" */\n"
+"#define HDEC_DICT_COUNT %u\n"
+"#define HDEC_DICT_BITS %u\n"
+"#define HDEC_DICT_MAX_ENC %u\n"
+"#define HDEC_DICT_ENC_SEED 0x%016llXull\n"
+"#define HDEC_DICT_PLAIN_SEED 0x%016llXull\n"
+"\n"
+"struct hdec_dict_el\n"
+"{\n"
+"    const char     *str;\n"
+"    uint8_t         len, enc_len;\n"
+"    unsigned char   enc[HDEC_DICT_MAX_ENC];\n"
+"};\n"
+"\n", (unsigned) DICT_COUNT, DICT_BITS, max_enc,
+                (unsigned long long) enc_seed, (unsigned long long) plain_seed);
+
+    printf("static const struct hdec_dict_el hdec_dict[%u] =\n{\n",
+                                                        (unsigned) DICT_COUNT);
+    for (i = 0; i < DICT_COUNT; ++i)
+    {
+        printf("    { \"");
+        for (p = dict_strs[i]; *p; ++p)
+            printf(*p == '"' || *p == '\\' ? "\\%c" : "%c", *p);
+        printf("\", %u, %u, {", (unsigned) strlen(dict_strs[i]),
+                                                                enc_lens[i]);
+        for (j = 0; j < enc_lens[i]; ++j)
+            printf(" 0x%02X,", enc[i][j]);
+        printf(" }, },\n");
+    }
+    printf("};\n\n");
+
+    printf("static const uint8_t hdec_dict_enc_slots[%u] =\n{\n",
+                                                            1 << DICT_BITS);
+    for (i = 0; i < 1 << DICT_BITS; ++i)
+        printf("%s%3u,%s", i % 16 ? " " : "    ", enc_slots[i],
+                                                i % 16 == 15 ? "\n" : "");
+    printf("};\n\n");
+
+    printf("static const uint8_t hdec_dict_plain_slots[%u] =\n{\n",
+                                                            1 << DICT_BITS);
+    for (i = 0; i < 1 << DICT_BITS; ++i)
+        printf("%s%3u,%s", i % 16 ? " " : "    ", plain_slots[i],
+                                                i % 16 == 15 ? "\n" : "");
+    printf("};\n");
+}
+
+
+static const struct
+{
+    const char   *name;
+    void        (*gen)(void);
+}
+generators[] =
+{
+    { "2level", gen_2level, },
+    { "canonical", gen_canonical, },
+    { "fsm8", gen_fsm8, },
+    { "class", gen_class, },
+    { "dict", gen_dict, },
+    { "digits", gen_digits, },
+    { "path", gen_path, },
+    { "cookie", gen_cookie, },
+};
+
+
+int
+main (int argc, char **argv)
+{
+    unsigned i;
+
+    if (argc == 2)
+        for (i = 0; i < sizeof(generators) / sizeof(generators[0]); ++i)
+            if (0 == strcmp(argv[1], generators[i].name))
+            {
+                generators[i].gen();
+                exit(EXIT_SUCCESS);
+            }
+
+    fprintf(stderr, "Usage: %s $table\n\n  $table is one of:\n", argv[0]);
+    for (i = 0; i < sizeof(generators) / sizeof(generators[0]); ++i)
+        fprintf(stderr, "    %s\n", generators[i].name);
+    exit(EXIT_FAILURE);
+}
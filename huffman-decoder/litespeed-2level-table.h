@@ -0,0 +1,459 @@
+/* Generated by `gen-tables 2level'; do not edit. */
+
+/* Codes longer than 16 bits all start with 15 1 bits.  The next 8 bits
+ * index hdec_long2.  An entry with non-zero width points to a subtable at
+ * hdec_long3[base] indexed by the following `width' bits.  Otherwise, it
+ * is a leaf: `len' is the total length of the code, zero for EOS.
+ */
+#define HDEC_LONG_PREFIX 15
+#define HDEC_LONG_L2_BITS 8
+
+struct hdec_long { uint8_t len, sym, width, base; };
+
+static const struct hdec_long hdec_long2[256] =
+{
+/*   0 */ { 19,  92, 0,   0 },
+/*   1 */ { 19,  92, 0,   0 },
+/*   2 */ { 19,  92, 0,   0 },
+/*   3 */ { 19,  92, 0,   0 },
+/*   4 */ { 19,  92, 0,   0 },
+/*   5 */ { 19,  92, 0,   0 },
+/*   6 */ { 19,  92, 0,   0 },
+/*   7 */ { 19,  92, 0,   0 },
+/*   8 */ { 19,  92, 0,   0 },
+/*   9 */ { 19,  92, 0,   0 },
+/*  10 */ { 19,  92, 0,   0 },
+/*  11 */ { 19,  92, 0,   0 },
+/*  12 */ { 19,  92, 0,   0 },
+/*  13 */ { 19,  92, 0,   0 },
+/*  14 */ { 19,  92, 0,   0 },
+/*  15 */ { 19,  92, 0,   0 },
+/*  16 */ { 19, 195, 0,   0 },
+/*  17 */ { 19, 195, 0,   0 },
+/*  18 */ { 19, 195, 0,   0 },
+/*  19 */ { 19, 195, 0,   0 },
+/*  20 */ { 19, 195, 0,   0 },
+/*  21 */ { 19, 195, 0,   0 },
+/*  22 */ { 19, 195, 0,   0 },
+/*  23 */ { 19, 195, 0,   0 },
+/*  24 */ { 19, 195, 0,   0 },
+/*  25 */ { 19, 195, 0,   0 },
+/*  26 */ { 19, 195, 0,   0 },
+/*  27 */ { 19, 195, 0,   0 },
+/*  28 */ { 19, 195, 0,   0 },
+/*  29 */ { 19, 195, 0,   0 },
+/*  30 */ { 19, 195, 0,   0 },
+/*  31 */ { 19, 195, 0,   0 },
+/*  32 */ { 19, 208, 0,   0 },
+/*  33 */ { 19, 208, 0,   0 },
+/*  34 */ { 19, 208, 0,   0 },
+/*  35 */ { 19, 208, 0,   0 },
+/*  36 */ { 19, 208, 0,   0 },
+/*  37 */ { 19, 208, 0,   0 },
+/*  38 */ { 19, 208, 0,   0 },
+/*  39 */ { 19, 208, 0,   0 },
+/*  40 */ { 19, 208, 0,   0 },
+/*  41 */ { 19, 208, 0,   0 },
+/*  42 */ { 19, 208, 0,   0 },
+/*  43 */ { 19, 208, 0,   0 },
+/*  44 */ { 19, 208, 0,   0 },
+/*  45 */ { 19, 208, 0,   0 },
+/*  46 */ { 19, 208, 0,   0 },
+/*  47 */ { 19, 208, 0,   0 },
+/*  48 */ { 20, 128, 0,   0 },
+/*  49 */ { 20, 128, 0,   0 },
+/*  50 */ { 20, 128, 0,   0 },
+/*  51 */ { 20, 128, 0,   0 },
+/*  52 */ { 20, 128, 0,   0 },
+/*  53 */ { 20, 128, 0,   0 },
+/*  54 */ { 20, 128, 0,   0 },
+/*  55 */ { 20, 128, 0,   0 },
+/*  56 */ { 20, 130, 0,   0 },
+/*  57 */ { 20, 130, 0,   0 },
+/*  58 */ { 20, 130, 0,   0 },
+/*  59 */ { 20, 130, 0,   0 },
+/*  60 */ { 20, 130, 0,   0 },
+/*  61 */ { 20, 130, 0,   0 },
+/*  62 */ { 20, 130, 0,   0 },
+/*  63 */ { 20, 130, 0,   0 },
+/*  64 */ { 20, 131, 0,   0 },
+/*  65 */ { 20, 131, 0,   0 },
+/*  66 */ { 20, 131, 0,   0 },
+/*  67 */ { 20, 131, 0,   0 },
+/*  68 */ { 20, 131, 0,   0 },
+/*  69 */ { 20, 131, 0,   0 },
+/*  70 */ { 20, 131, 0,   0 },
+/*  71 */ { 20, 131, 0,   0 },
+/*  72 */ { 20, 162, 0,   0 },
+/*  73 */ { 20, 162, 0,   0 },
+/*  74 */ { 20, 162, 0,   0 },
+/*  75 */ { 20, 162, 0,   0 },
+/*  76 */ { 20, 162, 0,   0 },
+/*  77 */ { 20, 162, 0,   0 },
+/*  78 */ { 20, 162, 0,   0 },
+/*  79 */ { 20, 162, 0,   0 },
+/*  80 */ { 20, 184, 0,   0 },
+/*  81 */ { 20, 184, 0,   0 },
+/*  82 */ { 20, 184, 0,   0 },
+/*  83 */ { 20, 184, 0,   0 },
+/*  84 */ { 20, 184, 0,   0 },
+/*  85 */ { 20, 184, 0,   0 },
+/*  86 */ { 20, 184, 0,   0 },
+/*  87 */ { 20, 184, 0,   0 },
+/*  88 */ { 20, 194, 0,   0 },
+/*  89 */ { 20, 194, 0,   0 },
+/*  90 */ { 20, 194, 0,   0 },
+/*  91 */ { 20, 194, 0,   0 },
+/*  92 */ { 20, 194, 0,   0 },
+/*  93 */ { 20, 194, 0,   0 },
+/*  94 */ { 20, 194, 0,   0 },
+/*  95 */ { 20, 194, 0,   0 },
+/*  96 */ { 20, 224, 0,   0 },
+/*  97 */ { 20, 224, 0,   0 },
+/*  98 */ { 20, 224, 0,   0 },
+/*  99 */ { 20, 224, 0,   0 },
+/* 100 */ { 20, 224, 0,   0 },
+/* 101 */ { 20, 224, 0,   0 },
+/* 102 */ { 20, 224, 0,   0 },
+/* 103 */ { 20, 224, 0,   0 },
+/* 104 */ { 20, 226, 0,   0 },
+/* 105 */ { 20, 226, 0,   0 },
+/* 106 */ { 20, 226, 0,   0 },
+/* 107 */ { 20, 226, 0,   0 },
+/* 108 */ { 20, 226, 0,   0 },
+/* 109 */ { 20, 226, 0,   0 },
+/* 110 */ { 20, 226, 0,   0 },
+/* 111 */ { 20, 226, 0,   0 },
+/* 112 */ { 21, 153, 0,   0 },
+/* 113 */ { 21, 153, 0,   0 },
+/* 114 */ { 21, 153, 0,   0 },
+/* 115 */ { 21, 153, 0,   0 },
+/* 116 */ { 21, 161, 0,   0 },
+/* 117 */ { 21, 161, 0,   0 },
+/* 118 */ { 21, 161, 0,   0 },
+/* 119 */ { 21, 161, 0,   0 },
+/* 120 */ { 21, 167, 0,   0 },
+/* 121 */ { 21, 167, 0,   0 },
+/* 122 */ { 21, 167, 0,   0 },
+/* 123 */ { 21, 167, 0,   0 },
+/* 124 */ { 21, 172, 0,   0 },
+/* 125 */ { 21, 172, 0,   0 },
+/* 126 */ { 21, 172, 0,   0 },
+/* 127 */ { 21, 172, 0,   0 },
+/* 128 */ { 21, 176, 0,   0 },
+/* 129 */ { 21, 176, 0,   0 },
+/* 130 */ { 21, 176, 0,   0 },
+/* 131 */ { 21, 176, 0,   0 },
+/* 132 */ { 21, 177, 0,   0 },
+/* 133 */ { 21, 177, 0,   0 },
+/* 134 */ { 21, 177, 0,   0 },
+/* 135 */ { 21, 177, 0,   0 },
+/* 136 */ { 21, 179, 0,   0 },
+/* 137 */ { 21, 179, 0,   0 },
+/* 138 */ { 21, 179, 0,   0 },
+/* 139 */ { 21, 179, 0,   0 },
+/* 140 */ { 21, 209, 0,   0 },
+/* 141 */ { 21, 209, 0,   0 },
+/* 142 */ { 21, 209, 0,   0 },
+/* 143 */ { 21, 209, 0,   0 },
+/* 144 */ { 21, 216, 0,   0 },
+/* 145 */ { 21, 216, 0,   0 },
+/* 146 */ { 21, 216, 0,   0 },
+/* 147 */ { 21, 216, 0,   0 },
+/* 148 */ { 21, 217, 0,   0 },
+/* 149 */ { 21, 217, 0,   0 },
+/* 150 */ { 21, 217, 0,   0 },
+/* 151 */ { 21, 217, 0,   0 },
+/* 152 */ { 21, 227, 0,   0 },
+/* 153 */ { 21, 227, 0,   0 },
+/* 154 */ { 21, 227, 0,   0 },
+/* 155 */ { 21, 227, 0,   0 },
+/* 156 */ { 21, 229, 0,   0 },
+/* 157 */ { 21, 229, 0,   0 },
+/* 158 */ { 21, 229, 0,   0 },
+/* 159 */ { 21, 229, 0,   0 },
+/* 160 */ { 21, 230, 0,   0 },
+/* 161 */ { 21, 230, 0,   0 },
+/* 162 */ { 21, 230, 0,   0 },
+/* 163 */ { 21, 230, 0,   0 },
+/* 164 */ { 22, 129, 0,   0 },
+/* 165 */ { 22, 129, 0,   0 },
+/* 166 */ { 22, 132, 0,   0 },
+/* 167 */ { 22, 132, 0,   0 },
+/* 168 */ { 22, 133, 0,   0 },
+/* 169 */ { 22, 133, 0,   0 },
+/* 170 */ { 22, 134, 0,   0 },
+/* 171 */ { 22, 134, 0,   0 },
+/* 172 */ { 22, 136, 0,   0 },
+/* 173 */ { 22, 136, 0,   0 },
+/* 174 */ { 22, 146, 0,   0 },
+/* 175 */ { 22, 146, 0,   0 },
+/* 176 */ { 22, 154, 0,   0 },
+/* 177 */ { 22, 154, 0,   0 },
+/* 178 */ { 22, 156, 0,   0 },
+/* 179 */ { 22, 156, 0,   0 },
+/* 180 */ { 22, 160, 0,   0 },
+/* 181 */ { 22, 160, 0,   0 },
+/* 182 */ { 22, 163, 0,   0 },
+/* 183 */ { 22, 163, 0,   0 },
+/* 184 */ { 22, 164, 0,   0 },
+/* 185 */ { 22, 164, 0,   0 },
+/* 186 */ { 22, 169, 0,   0 },
+/* 187 */ { 22, 169, 0,   0 },
+/* 188 */ { 22, 170, 0,   0 },
+/* 189 */ { 22, 170, 0,   0 },
+/* 190 */ { 22, 173, 0,   0 },
+/* 191 */ { 22, 173, 0,   0 },
+/* 192 */ { 22, 178, 0,   0 },
+/* 193 */ { 22, 178, 0,   0 },
+/* 194 */ { 22, 181, 0,   0 },
+/* 195 */ { 22, 181, 0,   0 },
+/* 196 */ { 22, 185, 0,   0 },
+/* 197 */ { 22, 185, 0,   0 },
+/* 198 */ { 22, 186, 0,   0 },
+/* 199 */ { 22, 186, 0,   0 },
+/* 200 */ { 22, 187, 0,   0 },
+/* 201 */ { 22, 187, 0,   0 },
+/* 202 */ { 22, 189, 0,   0 },
+/* 203 */ { 22, 189, 0,   0 },
+/* 204 */ { 22, 190, 0,   0 },
+/* 205 */ { 22, 190, 0,   0 },
+/* 206 */ { 22, 196, 0,   0 },
+/* 207 */ { 22, 196, 0,   0 },
+/* 208 */ { 22, 198, 0,   0 },
+/* 209 */ { 22, 198, 0,   0 },
+/* 210 */ { 22, 228, 0,   0 },
+/* 211 */ { 22, 228, 0,   0 },
+/* 212 */ { 22, 232, 0,   0 },
+/* 213 */ { 22, 232, 0,   0 },
+/* 214 */ { 22, 233, 0,   0 },
+/* 215 */ { 22, 233, 0,   0 },
+/* 216 */ { 23,   1, 0,   0 },
+/* 217 */ { 23, 135, 0,   0 },
+/* 218 */ { 23, 137, 0,   0 },
+/* 219 */ { 23, 138, 0,   0 },
+/* 220 */ { 23, 139, 0,   0 },
+/* 221 */ { 23, 140, 0,   0 },
+/* 222 */ { 23, 141, 0,   0 },
+/* 223 */ { 23, 143, 0,   0 },
+/* 224 */ { 23, 147, 0,   0 },
+/* 225 */ { 23, 149, 0,   0 },
+/* 226 */ { 23, 150, 0,   0 },
+/* 227 */ { 23, 151, 0,   0 },
+/* 228 */ { 23, 152, 0,   0 },
+/* 229 */ { 23, 155, 0,   0 },
+/* 230 */ { 23, 157, 0,   0 },
+/* 231 */ { 23, 158, 0,   0 },
+/* 232 */ { 23, 165, 0,   0 },
+/* 233 */ { 23, 166, 0,   0 },
+/* 234 */ { 23, 168, 0,   0 },
+/* 235 */ { 23, 174, 0,   0 },
+/* 236 */ { 23, 175, 0,   0 },
+/* 237 */ { 23, 180, 0,   0 },
+/* 238 */ { 23, 182, 0,   0 },
+/* 239 */ { 23, 183, 0,   0 },
+/* 240 */ { 23, 188, 0,   0 },
+/* 241 */ { 23, 191, 0,   0 },
+/* 242 */ { 23, 197, 0,   0 },
+/* 243 */ { 23, 231, 0,   0 },
+/* 244 */ { 23, 239, 0,   0 },
+/* 245 */ {  0,   0, 1,   0 },
+/* 246 */ {  0,   0, 1,   2 },
+/* 247 */ {  0,   0, 1,   4 },
+/* 248 */ {  0,   0, 1,   6 },
+/* 249 */ {  0,   0, 1,   8 },
+/* 250 */ {  0,   0, 1,  10 },
+/* 251 */ {  0,   0, 2,  12 },
+/* 252 */ {  0,   0, 3,  16 },
+/* 253 */ {  0,   0, 4,  24 },
+/* 254 */ {  0,   0, 4,  40 },
+/* 255 */ {  0,   0, 7,  56 },
+};
+
+static const struct hdec_long hdec_long3[184] =
+{
+/*   0 */ { 24,   9, 0, 0 },
+/*   1 */ { 24, 142, 0, 0 },
+/*   2 */ { 24, 144, 0, 0 },
+/*   3 */ { 24, 145, 0, 0 },
+/*   4 */ { 24, 148, 0, 0 },
+/*   5 */ { 24, 159, 0, 0 },
+/*   6 */ { 24, 171, 0, 0 },
+/*   7 */ { 24, 206, 0, 0 },
+/*   8 */ { 24, 215, 0, 0 },
+/*   9 */ { 24, 225, 0, 0 },
+/*  10 */ { 24, 236, 0, 0 },
+/*  11 */ { 24, 237, 0, 0 },
+/*  12 */ { 25, 199, 0, 0 },
+/*  13 */ { 25, 207, 0, 0 },
+/*  14 */ { 25, 234, 0, 0 },
+/*  15 */ { 25, 235, 0, 0 },
+/*  16 */ { 26, 192, 0, 0 },
+/*  17 */ { 26, 193, 0, 0 },
+/*  18 */ { 26, 200, 0, 0 },
+/*  19 */ { 26, 201, 0, 0 },
+/*  20 */ { 26, 202, 0, 0 },
+/*  21 */ { 26, 205, 0, 0 },
+/*  22 */ { 26, 210, 0, 0 },
+/*  23 */ { 26, 213, 0, 0 },
+/*  24 */ { 26, 218, 0, 0 },
+/*  25 */ { 26, 218, 0, 0 },
+/*  26 */ { 26, 219, 0, 0 },
+/*  27 */ { 26, 219, 0, 0 },
+/*  28 */ { 26, 238, 0, 0 },
+/*  29 */ { 26, 238, 0, 0 },
+/*  30 */ { 26, 240, 0, 0 },
+/*  31 */ { 26, 240, 0, 0 },
+/*  32 */ { 26, 242, 0, 0 },
+/*  33 */ { 26, 242, 0, 0 },
+/*  34 */ { 26, 243, 0, 0 },
+/*  35 */ { 26, 243, 0, 0 },
+/*  36 */ { 26, 255, 0, 0 },
+/*  37 */ { 26, 255, 0, 0 },
+/*  38 */ { 27, 203, 0, 0 },
+/*  39 */ { 27, 204, 0, 0 },
+/*  40 */ { 27, 211, 0, 0 },
+/*  41 */ { 27, 212, 0, 0 },
+/*  42 */ { 27, 214, 0, 0 },
+/*  43 */ { 27, 221, 0, 0 },
+/*  44 */ { 27, 222, 0, 0 },
+/*  45 */ { 27, 223, 0, 0 },
+/*  46 */ { 27, 241, 0, 0 },
+/*  47 */ { 27, 244, 0, 0 },
+/*  48 */ { 27, 245, 0, 0 },
+/*  49 */ { 27, 246, 0, 0 },
+/*  50 */ { 27, 247, 0, 0 },
+/*  51 */ { 27, 248, 0, 0 },
+/*  52 */ { 27, 250, 0, 0 },
+/*  53 */ { 27, 251, 0, 0 },
+/*  54 */ { 27, 252, 0, 0 },
+/*  55 */ { 27, 253, 0, 0 },
+/*  56 */ { 27, 254, 0, 0 },
+/*  57 */ { 27, 254, 0, 0 },
+/*  58 */ { 27, 254, 0, 0 },
+/*  59 */ { 27, 254, 0, 0 },
+/*  60 */ { 27, 254, 0, 0 },
+/*  61 */ { 27, 254, 0, 0 },
+/*  62 */ { 27, 254, 0, 0 },
+/*  63 */ { 27, 254, 0, 0 },
+/*  64 */ { 28,   2, 0, 0 },
+/*  65 */ { 28,   2, 0, 0 },
+/*  66 */ { 28,   2, 0, 0 },
+/*  67 */ { 28,   2, 0, 0 },
+/*  68 */ { 28,   3, 0, 0 },
+/*  69 */ { 28,   3, 0, 0 },
+/*  70 */ { 28,   3, 0, 0 },
+/*  71 */ { 28,   3, 0, 0 },
+/*  72 */ { 28,   4, 0, 0 },
+/*  73 */ { 28,   4, 0, 0 },
+/*  74 */ { 28,   4, 0, 0 },
+/*  75 */ { 28,   4, 0, 0 },
+/*  76 */ { 28,   5, 0, 0 },
+/*  77 */ { 28,   5, 0, 0 },
+/*  78 */ { 28,   5, 0, 0 },
+/*  79 */ { 28,   5, 0, 0 },
+/*  80 */ { 28,   6, 0, 0 },
+/*  81 */ { 28,   6, 0, 0 },
+/*  82 */ { 28,   6, 0, 0 },
+/*  83 */ { 28,   6, 0, 0 },
+/*  84 */ { 28,   7, 0, 0 },
+/*  85 */ { 28,   7, 0, 0 },
+/*  86 */ { 28,   7, 0, 0 },
+/*  87 */ { 28,   7, 0, 0 },
+/*  88 */ { 28,   8, 0, 0 },
+/*  89 */ { 28,   8, 0, 0 },
+/*  90 */ { 28,   8, 0, 0 },
+/*  91 */ { 28,   8, 0, 0 },
+/*  92 */ { 28,  11, 0, 0 },
+/*  93 */ { 28,  11, 0, 0 },
+/*  94 */ { 28,  11, 0, 0 },
+/*  95 */ { 28,  11, 0, 0 },
+/*  96 */ { 28,  12, 0, 0 },
+/*  97 */ { 28,  12, 0, 0 },
+/*  98 */ { 28,  12, 0, 0 },
+/*  99 */ { 28,  12, 0, 0 },
+/* 100 */ { 28,  14, 0, 0 },
+/* 101 */ { 28,  14, 0, 0 },
+/* 102 */ { 28,  14, 0, 0 },
+/* 103 */ { 28,  14, 0, 0 },
+/* 104 */ { 28,  15, 0, 0 },
+/* 105 */ { 28,  15, 0, 0 },
+/* 106 */ { 28,  15, 0, 0 },
+/* 107 */ { 28,  15, 0, 0 },
+/* 108 */ { 28,  16, 0, 0 },
+/* 109 */ { 28,  16, 0, 0 },
+/* 110 */ { 28,  16, 0, 0 },
+/* 111 */ { 28,  16, 0, 0 },
+/* 112 */ { 28,  17, 0, 0 },
+/* 113 */ { 28,  17, 0, 0 },
+/* 114 */ { 28,  17, 0, 0 },
+/* 115 */ { 28,  17, 0, 0 },
+/* 116 */ { 28,  18, 0, 0 },
+/* 117 */ { 28,  18, 0, 0 },
+/* 118 */ { 28,  18, 0, 0 },
+/* 119 */ { 28,  18, 0, 0 },
+/* 120 */ { 28,  19, 0, 0 },
+/* 121 */ { 28,  19, 0, 0 },
+/* 122 */ { 28,  19, 0, 0 },
+/* 123 */ { 28,  19, 0, 0 },
+/* 124 */ { 28,  20, 0, 0 },
+/* 125 */ { 28,  20, 0, 0 },
+/* 126 */ { 28,  20, 0, 0 },
+/* 127 */ { 28,  20, 0, 0 },
+/* 128 */ { 28,  21, 0, 0 },
+/* 129 */ { 28,  21, 0, 0 },
+/* 130 */ { 28,  21, 0, 0 },
+/* 131 */ { 28,  21, 0, 0 },
+/* 132 */ { 28,  23, 0, 0 },
+/* 133 */ { 28,  23, 0, 0 },
+/* 134 */ { 28,  23, 0, 0 },
+/* 135 */ { 28,  23, 0, 0 },
+/* 136 */ { 28,  24, 0, 0 },
+/* 137 */ { 28,  24, 0, 0 },
+/* 138 */ { 28,  24, 0, 0 },
+/* 139 */ { 28,  24, 0, 0 },
+/* 140 */ { 28,  25, 0, 0 },
+/* 141 */ { 28,  25, 0, 0 },
+/* 142 */ { 28,  25, 0, 0 },
+/* 143 */ { 28,  25, 0, 0 },
+/* 144 */ { 28,  26, 0, 0 },
+/* 145 */ { 28,  26, 0, 0 },
+/* 146 */ { 28,  26, 0, 0 },
+/* 147 */ { 28,  26, 0, 0 },
+/* 148 */ { 28,  27, 0, 0 },
+/* 149 */ { 28,  27, 0, 0 },
+/* 150 */ { 28,  27, 0, 0 },
+/* 151 */ { 28,  27, 0, 0 },
+/* 152 */ { 28,  28, 0, 0 },
+/* 153 */ { 28,  28, 0, 0 },
+/* 154 */ { 28,  28, 0, 0 },
+/* 155 */ { 28,  28, 0, 0 },
+/* 156 */ { 28,  29, 0, 0 },
+/* 157 */ { 28,  29, 0, 0 },
+/* 158 */ { 28,  29, 0, 0 },
+/* 159 */ { 28,  29, 0, 0 },
+/* 160 */ { 28,  30, 0, 0 },
+/* 161 */ { 28,  30, 0, 0 },
+/* 162 */ { 28,  30, 0, 0 },
+/* 163 */ { 28,  30, 0, 0 },
+/* 164 */ { 28,  31, 0, 0 },
+/* 165 */ { 28,  31, 0, 0 },
+/* 166 */ { 28,  31, 0, 0 },
+/* 167 */ { 28,  31, 0, 0 },
+/* 168 */ { 28, 127, 0, 0 },
+/* 169 */ { 28, 127, 0, 0 },
+/* 170 */ { 28, 127, 0, 0 },
+/* 171 */ { 28, 127, 0, 0 },
+/* 172 */ { 28, 220, 0, 0 },
+/* 173 */ { 28, 220, 0, 0 },
+/* 174 */ { 28, 220, 0, 0 },
+/* 175 */ { 28, 220, 0, 0 },
+/* 176 */ { 28, 249, 0, 0 },
+/* 177 */ { 28, 249, 0, 0 },
+/* 178 */ { 28, 249, 0, 0 },
+/* 179 */ { 28, 249, 0, 0 },
+/* 180 */ { 30,  10, 0, 0 },
+/* 181 */ { 30,  13, 0, 0 },
+/* 182 */ { 30,  22, 0, 0 },
+/* 183 */ {  0,   0, 0, 0 },
+};
@@ -0,0 +1,262 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "litespeed-table.h"
+#include "litespeed-2level-table.h"
+
+#define SHORTEST_CODE 5
+#define LONGEST_CODE 30
+
+/* Bits of the long-code window below the second-level index */
+#define L2_SHIFT (LONGEST_CODE - HDEC_LONG_PREFIX - HDEC_LONG_L2_BITS)
+
+
+/* Decode one code longer than 16 bits.  It starts at the top of the
+ * `avail_bits' bits in `buf'.  If the buffer does not hold the whole code,
+ * the window is completed by peeking at the input and, past its end, by
+ * padding with 1 bits, just like EOS padding would be.
+ *
+ * Returns the length of the code or zero if the code is EOS or is
+ * truncated.  The caller consumes input past `src' if the code is longer
+ * than `avail_bits'.
+ */
+static unsigned
+hdec_long_code (uintptr_t buf, unsigned avail_bits,
+        const unsigned char *src, const unsigned char *const src_end,
+        unsigned char *dst)
+{
+    struct hdec_long el;
+    uint64_t win;
+    unsigned nbits, in_bits;
+
+    if (avail_bits >= LONGEST_CODE)
+    {
+        win = buf >> (avail_bits - LONGEST_CODE);
+        in_bits = avail_bits;
+    }
+    else
+    {
+        win = buf & (((uint64_t) 1 << avail_bits) - 1);
+        in_bits = avail_bits;
+        for (nbits = avail_bits; nbits < LONGEST_CODE; nbits += 8)
+        {
+            win <<= 8;
+            if (src < src_end)
+            {
+                win |= *src++;
+                in_bits += 8;
+            }
+            else
+                win |= 0xFF;
+        }
+        win >>= nbits - LONGEST_CODE;
+    }
+    el = hdec_long2[ (win >> L2_SHIFT) & ((1u << HDEC_LONG_L2_BITS) - 1) ];
+    if (el.width)
+        el = hdec_long3[ el.base
+                + ((win >> (L2_SHIFT - el.width)) & ((1u << el.width) - 1)) ];
+    if (el.len == 0 || el.len > in_bits)
+        return 0;
+    *dst = el.sym;
+    return el.len;
+}
+
+
+/* This is lshpack_dec_huff_decode() without the slow path.  When `hdecs'
+ * has no entry for the next code, the code is longer than 16 bits and it
+ * is decoded using two small secondary tables.  This way, a single long
+ * code does not force the rest of the string through the 4-bit FSM.
+ */
+int
+lshpack_dec_huff_decode_2level (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uintptr_t buf;
+    unsigned avail_bits, len;
+    struct hdec hdec;
+    uint16_t idx;
+
+    buf = 0;
+    avail_bits = 0;
+    while (1)
+    {
+        if (src + sizeof(buf) <= src_end)
+        {
+            len = (sizeof(buf) * 8 - avail_bits) >> 3;
+            avail_bits += len << 3;
+            switch (len)
+            {
+#if UINTPTR_MAX == 18446744073709551615ull
+            case 8:
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+            case 7:
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+            default:
+                buf <<= 48;
+                buf |= (uintptr_t) *src++ << 40;
+                buf |= (uintptr_t) *src++ << 32;
+                buf |= (uintptr_t) *src++ << 24;
+                buf |= (uintptr_t) *src++ << 16;
+#else
+            case 4:
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+            case 3:
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+            default:
+                buf <<= 16;
+#endif
+                buf |= (uintptr_t) *src++ <<  8;
+                buf |= (uintptr_t) *src++ <<  0;
+            }
+        }
+        else if (src < src_end)
+            do
+            {
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+                avail_bits += 8;
+            }
+            while (src < src_end && avail_bits <= sizeof(buf) * 8 - 8);
+        else
+            break;  /* Normal case terminating condition: out of input */
+
+        if (dst_end - dst >= (ptrdiff_t) (8 * sizeof(buf) / SHORTEST_CODE)
+                                                            && avail_bits >= 16)
+        {
+            /* Fast path: don't check destination bounds.  A long code
+             * produces one byte out of at least 19 bits and leaves fewer
+             * than 16 bits in the buffer if it reads past it, so the
+             * bound above still holds.
+             */
+            do
+            {
+                idx = buf >> (avail_bits - 16);
+                hdec = hdecs[idx];
+                dst[0] = hdec.out[0];
+                dst[1] = hdec.out[1];
+                dst[2] = hdec.out[2];
+                if (hdec.lens)
+                {
+                    dst += hdec.lens & 3;
+                    avail_bits -= hdec.lens >> 2;
+                }
+                else
+                {
+                    len = hdec_long_code(buf, avail_bits, src, src_end, dst);
+                    if (!len)
+                        return -1;
+                    ++dst;
+                    while (avail_bits < len)
+                    {
+                        buf <<= 8;
+                        buf |= (uintptr_t) *src++;
+                        avail_bits += 8;
+                    }
+                    avail_bits -= len;
+                }
+            }
+            while (avail_bits >= 16);
+        }
+        else
+            while (avail_bits >= 16)
+            {
+                idx = buf >> (avail_bits - 16);
+                hdec = hdecs[idx];
+                len = hdec.lens & 3;
+                if (len && dst + len <= dst_end)
+                {
+                    switch (len)
+                    {
+                    case 3:
+                        *dst++ = hdec.out[0];
+                        *dst++ = hdec.out[1];
+                        *dst++ = hdec.out[2];
+                        break;
+                    case 2:
+                        *dst++ = hdec.out[0];
+                        *dst++ = hdec.out[1];
+                        break;
+                    default:
+                        *dst++ = hdec.out[0];
+                        break;
+                    }
+                    avail_bits -= hdec.lens >> 2;
+                }
+                else if (dst + len > dst_end)
+                    return -2;
+                else if (dst == dst_end)
+                    return -2;
+                else
+                {
+                    len = hdec_long_code(buf, avail_bits, src, src_end, dst);
+                    if (!len)
+                        return -1;
+                    ++dst;
+                    while (avail_bits < len)
+                    {
+                        buf <<= 8;
+                        buf |= (uintptr_t) *src++;
+                        avail_bits += 8;
+                    }
+                    avail_bits -= len;
+                }
+            }
+    }
+
+    if (avail_bits >= SHORTEST_CODE)
+    {
+        idx = buf << (16 - avail_bits);
+        idx |= (1 << (16 - avail_bits)) - 1;    /* EOF */
+        if (idx == 0xFFFF && avail_bits < 8)
+            goto end;
+        /* If a byte or more of input is left, this mean there is a valid
+         * encoding, not just EOF.
+         */
+        hdec = hdecs[idx];
+        len = hdec.lens & 3;
+        if ((hdec.lens >> 2) > avail_bits)
+            /* The last code runs into the padding: padding is not EOS */
+            return -1;
+        if (len && dst + len <= dst_end)
+        {
+            switch (len)
+            {
+            case 3:
+                *dst++ = hdec.out[0];
+                *dst++ = hdec.out[1];
+                *dst++ = hdec.out[2];
+                break;
+            case 2:
+                *dst++ = hdec.out[0];
+                *dst++ = hdec.out[1];
+                break;
+            default:
+                *dst++ = hdec.out[0];
+                break;
+            }
+            avail_bits -= hdec.lens >> 2;
+        }
+        else if (dst + len > dst_end)
+            return -2;
+        else
+            /* This must be an invalid code, otherwise it would have fit */
+            return -1;
+    }
+
+    if (avail_bits > 0)
+    {
+        if (avail_bits >= 8
+                || ((1u << avail_bits) - 1) != (buf & ((1u << avail_bits) - 1)))
+            return -1;  /* Not EOF as expected */
+    }
+
+  end:
+    return dst - orig_dst;
+}
@@ -0,0 +1,41 @@
+#include <stddef.h>
+
+#include "litespeed-arena.h"
+
+int
+lshpack_dec_huff_decode_class (const unsigned char *src, int src_len,
+                    unsigned char *dst, int dst_len, unsigned *classes);
+
+
+/* Decode the `count' strings of a header block into the arena, one right
+ * after another, and point `views' at them.  Each string is decoded in
+ * place at the end of what is used, which then grows by its exact length:
+ * there is no scratch buffer of the worst-case size and no copy out of
+ * it, and the arena needs room for the output only.
+ *
+ * Returns 0, or -1 or -2 as lshpack_dec_huff_decode() does for the first
+ * string that cannot be decoded; -2 means that the arena is full.  The
+ * strings before it are in the arena and their views are set.
+ */
+int
+lshpack_dec_huff_decode_arena (struct lshpack_arena *arena, unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        struct lshpack_str_view *views)
+{
+    unsigned i;
+    int len;
+
+    for (i = 0; i < count; ++i)
+    {
+        /* The output is never longer than the rest of the arena */
+        len = lshpack_dec_huff_decode_class(srcs[i], src_lens[i],
+                arena->buf + arena->used, arena->size - arena->used, NULL);
+        if (len < 0)
+            return len;
+        views[i].ptr = arena->buf + arena->used;
+        views[i].len = len;
+        arena->used += len;
+    }
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#ifndef LITESPEED_ARENA_H
+#define LITESPEED_ARENA_H 1
+
+/* Memory that strings are decoded into one after another, each taking
+ * exactly its length (litespeed-arena.c).  It is reset, not freed, when
+ * the request is done with.
+ */
+struct lshpack_arena
+{
+    unsigned char  *buf;
+    unsigned        size;
+    unsigned        used;
+};
+
+/* A decoded string in the arena */
+struct lshpack_str_view
+{
+    const unsigned char    *ptr;
+    int                     len;
+};
+
+
+static inline void
+lshpack_arena_init (struct lshpack_arena *arena, unsigned char *buf,
+                                                                unsigned size)
+{
+    arena->buf = buf;
+    arena->size = size;
+    arena->used = 0;
+}
+
+
+static inline void
+lshpack_arena_reset (struct lshpack_arena *arena)
+{
+    arena->used = 0;
+}
+
+
+int
+lshpack_dec_huff_decode_arena (struct lshpack_arena *, unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        struct lshpack_str_view *views);
+
+#endif
@@ -0,0 +1,279 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+
+/* Number of strings decoded in lockstep */
+#define BATCH_LANES 4
+
+int
+lshpack_dec_huff_decode_2level (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+
+/* Number of fast steps each lane takes per round.  A full refill leaves
+ * at least 56 bits in the buffer, enough for three 16-bit lookups.
+ */
+#define BATCH_STEPS 3
+
+/* Shorter strings are decoded one at a time.  A lane cannot take a round
+ * until eight bytes of input are left, and a short string spends most of
+ * its time in lane_finish() anyway.
+ */
+#define BATCH_MIN_LEN 16
+
+
+struct lane
+{
+    const unsigned char    *src, *src_end;  /* src_end is NULL if idle */
+    unsigned char          *dst, *dst_start, *dst_end;
+    uint64_t                buf;            /* Left-aligned */
+    unsigned                avail_bits;
+    unsigned                str;            /* Index of string in batch */
+};
+
+
+/* Top up the buffer with a single unaligned load.  There must be at least
+ * eight bytes of input left.
+ */
+static inline void
+lane_refill (struct lane *lane)
+{
+    uint64_t word;
+
+    memcpy(&word, lane->src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+    word = bswap_64(word);
+#endif
+    lane->buf |= word >> lane->avail_bits;
+    lane->src += (63 - lane->avail_bits) >> 3;
+    lane->avail_bits |= 56;
+}
+
+
+/* The lane cannot take another round of fast steps: fewer than eight
+ * bytes of input are left, the destination is almost full, or the next
+ * code is longer than 16 bits.  Go back to the previous byte boundary, as
+ * the slow path in lshpack_dec_huff_decode() does, and finish the string
+ * with the two-level decoder, which handles long codes without a slow
+ * path.
+ */
+static int
+lane_finish (struct lane *lane)
+{
+    int r;
+
+    while ((lane->avail_bits & 7) && lane->dst > lane->dst_start)
+        lane->avail_bits += encode_table[ *--lane->dst ].bits;
+    lane->src -= lane->avail_bits >> 3;
+    r = lshpack_dec_huff_decode_2level(lane->src, lane->src_end - lane->src,
+                                    lane->dst, lane->dst_end - lane->dst);
+    if (r >= 0)
+        return lane->dst - lane->dst_start + r;
+    else
+        return r;
+}
+
+
+static int
+lane_can_step (const struct lane *lane)
+{
+    return lane->src + sizeof(lane->buf) <= lane->src_end
+        && lane->dst_end - lane->dst >= 3 * BATCH_STEPS
+        && (lane->avail_bits < 16 || hdecs[ lane->buf >> 48 ].lens);
+}
+
+
+/* Return the index of the first string from `i' on that is long enough
+ * for a lane, or `count' if there is none.
+ */
+static unsigned
+batch_next (unsigned i, unsigned count, const int *src_lens)
+{
+    while (i < count && src_lens[i] < BATCH_MIN_LEN)
+        ++i;
+    return i;
+}
+
+
+static void
+lane_load (struct lane *lane, unsigned str, const unsigned char *src,
+                        int src_len, unsigned char *dst, int dst_len)
+{
+    lane->src = src;
+    lane->src_end = src + src_len;
+    lane->dst = lane->dst_start = dst;
+    lane->dst_end = dst + dst_len;
+    lane->buf = 0;
+    lane->avail_bits = 0;
+    lane->str = str;
+}
+
+
+/* One round for a single lane, used when some lanes are idle */
+static void
+lane_round (struct lane *lane)
+{
+    struct hdec hdec;
+    unsigned step;
+
+    lane_refill(lane);
+    for (step = 0; step < BATCH_STEPS; ++step)
+    {
+        hdec = hdecs[ lane->buf >> 48 ];
+        lane->dst[0] = hdec.out[0];
+        lane->dst[1] = hdec.out[1];
+        lane->dst[2] = hdec.out[2];
+        lane->dst += hdec.lens & 3;
+        lane->buf <<= hdec.lens >> 2;
+        lane->avail_bits -= hdec.lens >> 2;
+    }
+}
+
+
+/* Rounds for all lanes while every one of them can keep going.  The lane
+ * state is copied into local arrays, which the compiler keeps in registers
+ * once the loops over lanes are unrolled.
+ */
+static void
+batch_rounds (struct lane *lanes)
+{
+    const unsigned char *src[BATCH_LANES], *src_lim[BATCH_LANES];
+    unsigned char *dst[BATCH_LANES], *dst_lim[BATCH_LANES];
+    uint64_t buf[BATCH_LANES], word;
+    unsigned avail_bits[BATCH_LANES], l, step;
+    struct hdec hdec;
+    int go;
+
+    for (l = 0; l < BATCH_LANES; ++l)
+    {
+        src[l] = lanes[l].src;
+        src_lim[l] = lanes[l].src_end - sizeof(word);
+        dst[l] = lanes[l].dst;
+        dst_lim[l] = lanes[l].dst_end - 3 * BATCH_STEPS;
+        buf[l] = lanes[l].buf;
+        avail_bits[l] = lanes[l].avail_bits;
+    }
+
+    do
+    {
+        for (l = 0; l < BATCH_LANES; ++l)
+        {
+            memcpy(&word, src[l], sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+            word = bswap_64(word);
+#endif
+            buf[l] |= word >> avail_bits[l];
+            src[l] += (63 - avail_bits[l]) >> 3;
+            avail_bits[l] |= 56;
+        }
+        for (step = 0; step < BATCH_STEPS; ++step)
+            for (l = 0; l < BATCH_LANES; ++l)
+            {
+                hdec = hdecs[ buf[l] >> 48 ];
+                dst[l][0] = hdec.out[0];
+                dst[l][1] = hdec.out[1];
+                dst[l][2] = hdec.out[2];
+                dst[l] += hdec.lens & 3;
+                buf[l] <<= hdec.lens >> 2;
+                avail_bits[l] -= hdec.lens >> 2;
+            }
+        go = 1;
+        for (l = 0; l < BATCH_LANES; ++l)
+            go &= (src[l] <= src_lim[l]) & (dst[l] <= dst_lim[l])
+                & (hdecs[ buf[l] >> 48 ].lens != 0);
+    }
+    while (go);
+
+    for (l = 0; l < BATCH_LANES; ++l)
+    {
+        lanes[l].src = src[l];
+        lanes[l].dst = dst[l];
+        lanes[l].buf = buf[l];
+        lanes[l].avail_bits = avail_bits[l];
+    }
+}
+
+
+
+/* Decode `count' independent strings.  Instead of decoding one string to
+ * the end before starting the next, BATCH_LANES strings advance in rounds:
+ * each lane is refilled and then the lanes take BATCH_STEPS table steps
+ * each in turn.  The steps of different strings do not depend on each
+ * other, so the CPU overlaps the latency of their `hdecs' loads.  A step
+ * that hits a long code does nothing -- its entry consumes no bits -- and
+ * the lane is retired before the next round.  Strings shorter than
+ * BATCH_MIN_LEN bytes do not go into lanes; they are decoded one at a time
+ * first.
+ *
+ * The result for string i is placed into results[i]: the decoded length,
+ * -1 if the string is invalid, or -2 if dst_lens[i] is too small.  Returns
+ * 0 if all strings are decoded successfully and -1 otherwise.
+ */
+int
+lshpack_dec_huff_decode_batch (unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        unsigned char *const *dsts, const int *dst_lens, int *results)
+{
+    struct lane lanes[BATCH_LANES], *lane;
+    unsigned next, n_active, l, i;
+    int failed;
+
+    failed = 0;
+    for (i = 0; i < count; ++i)
+        if (src_lens[i] < BATCH_MIN_LEN)
+        {
+            results[i] = lshpack_dec_huff_decode_2level(srcs[i], src_lens[i],
+                                                    dsts[i], dst_lens[i]);
+            failed |= results[i] < 0;
+        }
+
+    next = batch_next(0, count, src_lens);
+    n_active = 0;
+    for (l = 0; l < BATCH_LANES; ++l)
+        if (next < count)
+        {
+            lane_load(&lanes[l], next, srcs[next], src_lens[next],
+                                            dsts[next], dst_lens[next]);
+            next = batch_next(next + 1, count, src_lens);
+            ++n_active;
+        }
+        else
+            lanes[l].src_end = NULL;
+
+    while (n_active)
+    {
+        for (l = 0; l < BATCH_LANES; ++l)
+        {
+            lane = &lanes[l];
+            while (lane->src_end && !lane_can_step(lane))
+            {
+                results[lane->str] = lane_finish(lane);
+                failed |= results[lane->str] < 0;
+                if (next < count)
+                {
+                    lane_load(lane, next, srcs[next], src_lens[next],
+                                            dsts[next], dst_lens[next]);
+                    next = batch_next(next + 1, count, src_lens);
+                }
+                else
+                {
+                    lane->src_end = NULL;
+                    --n_active;
+                }
+            }
+        }
+
+        if (n_active == BATCH_LANES)
+            batch_rounds(lanes);
+        else
+            for (l = 0; l < BATCH_LANES; ++l)
+                if (lanes[l].src_end)
+                    lane_round(&lanes[l]);
+    }
+
+    return failed ? -1 : 0;
+}
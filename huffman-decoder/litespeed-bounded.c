@@ -0,0 +1,104 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+
+
+/* A decoder whose cost has a ceiling that no input can raise.  Every step
+ * of the main loop does the same work: one 8-byte load to refill, one
+ * lookup in `hdecs', and one canonical decode of the code at the top of
+ * the buffer, which is used in place of the lookup if the code is longer
+ * than 16 bits.  The choice is a select, not a branch, so mixing short and
+ * long codes costs no mispredictions, and there is no fallback to the
+ * 4-bit FSM as in lshpack_dec_huff_decode().
+ *
+ * A step consumes at least five bits, and two steps in a row more than
+ * 16: the first takes all the codes that fit into 16 bits, so the code
+ * that the second starts with does not fit with them.  That is at most
+ * 2 * 8 / 17 steps per input byte -- short codes come three per lookup and
+ * are far cheaper -- plus the last eight bytes, decoded one code at a
+ * time.  A step is about 20 instructions with no data-dependent branches;
+ * see README.txt for the cycles it takes here.
+ *
+ * Invalid input is found when it is reached: a string that ends badly has
+ * been decoded up to there, at the same cost per byte.
+ */
+int
+lshpack_dec_huff_decode_bounded (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf, word;     /* Left-aligned: next bit is the top bit */
+    uint32_t win;
+    unsigned avail_bits, len, long_len, long_mask;
+    unsigned char sym;
+    struct hdec hdec;
+    uint16_t idx;
+    int r;
+
+    buf = 0;
+    avail_bits = 0;
+
+    /* Main loop: refill before each step, so that even a 30-bit code is
+     * in the buffer in full.
+     */
+    while (src + sizeof(word) <= src_end && dst_end - dst >= 3)
+    {
+        memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        word = bswap_64(word);
+#endif
+        buf |= word >> avail_bits;
+        src += (63 - avail_bits) >> 3;
+        avail_bits |= 56;
+
+        hdec = hdecs[ buf >> 48 ];
+        win = buf >> 32;
+        long_len = hdec_canon_len(win);
+        if (long_len == 0)
+            return -1;                  /* EOS */
+        sym = hdec_canon_sym(win, long_len);
+
+        /* The entry for a long code is all zeros, so masks take the place
+         * of branches: compilers turn a conditional here into a jump.
+         */
+        long_mask = -(unsigned) (hdec.lens == 0);
+        dst[0] = hdec.out[0] | (sym & long_mask);
+        dst[1] = hdec.out[1];
+        dst[2] = hdec.out[2];
+        dst += (hdec.lens & 3) + (1 & long_mask);
+        len = (hdec.lens >> 2) + (long_len & long_mask);
+        buf <<= len;
+        avail_bits -= len;
+    }
+
+    /* The last bytes of input or the last few bytes of output */
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (r == 0)
+            break;
+        if (dst_end - dst < (hdec.lens & 3))
+            return -2;
+        memcpy(dst, hdec.out, hdec.lens & 3);
+        dst += hdec.lens & 3;
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    return dst - orig_dst;
+}
@@ -0,0 +1,153 @@
+/* Generated by `gen-tables canonical'; do not edit. */
+
+/* The RFC 7541 code is canonical.  A code with k leading 1 bits is
+ * between hdec_canon_len0[k] and hdec_canon_len0[k] + 2 bits long: one
+ * bit longer for each limit in hdec_canon_lim[k] that the left-aligned
+ * 32-bit window is at or above.  The symbol is then
+ *
+ *   hdec_canon_syms[ (window >> (32 - len)) + hdec_canon_base[len] ]
+ *
+ * Thirty leading 1 bits is EOS.
+ */
+#define HDEC_CANON_MAX_ONES 30
+
+static const uint8_t hdec_canon_len0[31] =
+{
+     5,    /*  0 */
+     6,    /*  1 */
+     7,    /*  2 */
+     7,    /*  3 */
+     7,    /*  4 */
+     8,    /*  5 */
+     8,    /*  6 */
+    10,    /*  7 */
+    10,    /*  8 */
+    11,    /*  9 */
+    13,    /* 10 */
+    13,    /* 11 */
+    14,    /* 12 */
+    15,    /* 13 */
+    15,    /* 14 */
+    19,    /* 15 */
+    21,    /* 16 */
+    22,    /* 17 */
+    23,    /* 18 */
+    23,    /* 19 */
+    24,    /* 20 */
+    26,    /* 21 */
+    27,    /* 22 */
+    27,    /* 23 */
+    28,    /* 24 */
+    28,    /* 25 */
+    28,    /* 26 */
+    28,    /* 27 */
+    30,    /* 28 */
+    30,    /* 29 */
+    30,    /* 30 */
+};
+
+static const uint32_t hdec_canon_lim[31][2] =
+{
+    { 0x50000000, 0xFFFFFFFF, },    /*  0 */
+    { 0xB8000000, 0xFFFFFFFF, },    /*  1 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /*  2 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /*  3 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /*  4 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /*  5 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /*  6 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /*  7 */
+    { 0xFF400000, 0xFFFFFFFF, },    /*  8 */
+    { 0xFFA00000, 0xFFFFFFFF, },    /*  9 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 10 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 11 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 12 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 13 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 14 */
+    { 0xFFFE6000, 0xFFFEE000, },    /* 15 */
+    { 0xFFFF4800, 0xFFFFFFFF, },    /* 16 */
+    { 0xFFFFB000, 0xFFFFFFFF, },    /* 17 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 18 */
+    { 0xFFFFEA00, 0xFFFFFFFF, },    /* 19 */
+    { 0xFFFFF600, 0xFFFFFFFF, },    /* 20 */
+    { 0xFFFFFBC0, 0xFFFFFFFF, },    /* 21 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 22 */
+    { 0xFFFFFE20, 0xFFFFFFFF, },    /* 23 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 24 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 25 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 26 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 27 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 28 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 29 */
+    { 0xFFFFFFFF, 0xFFFFFFFF, },    /* 30 */
+};
+
+static const int32_t hdec_canon_base[31] =
+{
+              0,    /*  0 */
+              0,    /*  1 */
+              0,    /*  2 */
+              0,    /*  3 */
+              0,    /*  4 */
+              0,    /*  5 */
+            -10,    /*  6 */
+            -56,    /*  7 */
+           -180,    /*  8 */
+              0,    /*  9 */
+           -942,    /* 10 */
+          -1963,    /* 11 */
+          -4008,    /* 12 */
+          -8100,    /* 13 */
+         -16290,    /* 14 */
+         -32672,    /* 15 */
+              0,    /* 16 */
+              0,    /* 17 */
+              0,    /* 18 */
+        -524177,    /* 19 */
+       -1048452,    /* 20 */
+       -2097010,    /* 21 */
+       -4194139,    /* 22 */
+       -8388423,    /* 23 */
+      -16777020,    /* 24 */
+      -33554226,    /* 25 */
+      -67108642,    /* 26 */
+     -134217489,    /* 27 */
+     -268435202,    /* 28 */
+              0,    /* 29 */
+    -1073741567,    /* 30 */
+};
+
+static const uint8_t hdec_canon_syms[256] =
+{
+     48,  49,  50,  97,  99, 101, 105, 111,
+    115, 116,  32,  37,  45,  46,  47,  51,
+     52,  53,  54,  55,  56,  57,  61,  65,
+     95,  98, 100, 102, 103, 104, 108, 109,
+    110, 112, 114, 117,  58,  66,  67,  68,
+     69,  70,  71,  72,  73,  74,  75,  76,
+     77,  78,  79,  80,  81,  82,  83,  84,
+     85,  86,  87,  89, 106, 107, 113, 118,
+    119, 120, 121, 122,  38,  42,  44,  59,
+     88,  90,  33,  34,  40,  41,  63,  39,
+     43, 124,  35,  62,   0,  36,  64,  91,
+     93, 126,  94, 125,  60,  96, 123,  92,
+    195, 208, 128, 130, 131, 162, 184, 194,
+    224, 226, 153, 161, 167, 172, 176, 177,
+    179, 209, 216, 217, 227, 229, 230, 129,
+    132, 133, 134, 136, 146, 154, 156, 160,
+    163, 164, 169, 170, 173, 178, 181, 185,
+    186, 187, 189, 190, 196, 198, 228, 232,
+    233,   1, 135, 137, 138, 139, 140, 141,
+    143, 147, 149, 150, 151, 152, 155, 157,
+    158, 165, 166, 168, 174, 175, 180, 182,
+    183, 188, 191, 197, 231, 239,   9, 142,
+    144, 145, 148, 159, 171, 206, 215, 225,
+    236, 237, 199, 207, 234, 235, 192, 193,
+    200, 201, 202, 205, 210, 213, 218, 219,
+    238, 240, 242, 243, 255, 203, 204, 211,
+    212, 214, 221, 222, 223, 241, 244, 245,
+    246, 247, 248, 250, 251, 252, 253, 254,
+      2,   3,   4,   5,   6,   7,   8,  11,
+     12,  14,  15,  16,  17,  18,  19,  20,
+     21,  23,  24,  25,  26,  27,  28,  29,
+     30,  31, 127, 220, 249,  10,  13,  22,
+};
@@ -0,0 +1,68 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "litespeed-canonical-table.h"
+
+#define LONGEST_CODE 30
+
+
+/* Canonical Huffman decoder.  Instead of a 64 KB table indexed by input,
+ * it counts the leading 1 bits of the next 32 bits of input to narrow the
+ * code length down to at most three candidates, picks one using two
+ * comparisons and looks up the symbol by its position among the codes of
+ * that length.  Each symbol takes the same number of steps whatever its
+ * length, and all the tables together take up less than 700 bytes.
+ */
+int
+lshpack_dec_huff_decode_canonical (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf;           /* Left-aligned: next bit is the top bit */
+    uint32_t win;
+    unsigned avail_bits, ones, len;
+
+    buf = 0;
+    avail_bits = 0;
+    while (1)
+    {
+        if (avail_bits < LONGEST_CODE)
+        {
+            while (src < src_end && avail_bits <= sizeof(buf) * 8 - 8)
+            {
+                buf |= (uint64_t) *src++ << (sizeof(buf) * 8 - 8 - avail_bits);
+                avail_bits += 8;
+            }
+            if (avail_bits == 0)
+                break;
+        }
+
+        win = buf >> 32;
+        if (avail_bits < 32)
+            win |= 0xFFFFFFFFu >> avail_bits;       /* EOF */
+
+        /* `| 3' caps the count of leading 1 bits at HDEC_CANON_MAX_ONES */
+        ones = __builtin_clz(~win | 3);
+        if (ones >= HDEC_CANON_MAX_ONES)
+        {
+            if (avail_bits < 8)
+                break;      /* Padding */
+            return -1;      /* EOS */
+        }
+        len = hdec_canon_len0[ones]
+            + (win >= hdec_canon_lim[ones][0])
+            + (win >= hdec_canon_lim[ones][1]);
+        if (len > avail_bits)
+            return -1;      /* Code is truncated or padding is not EOS */
+        if (dst == dst_end)
+            return -2;
+        *dst++ = hdec_canon_syms[
+                        (int32_t) (win >> (32 - len)) + hdec_canon_base[len] ];
+        buf <<= len;
+        avail_bits -= len;
+    }
+
+    return dst - orig_dst;
+}
@@ -0,0 +1,106 @@
+#ifndef LITESPEED_CANONICAL_H
+#define LITESPEED_CANONICAL_H 1
+
+/* The canonical decoding step of litespeed-canonical.c, for decoders that
+ * look up 16 bits at a time in `hdecs' and decode the codes that it does
+ * not cover this way.  Include it after litespeed-table.h and
+ * litespeed-canonical-table.h.
+ */
+
+/* Steps per refill in the fast loops.  A refill with a single 8-byte load
+ * leaves at least 56 bits in the buffer, enough for three 16-bit lookups.
+ */
+#define HDEC_STEPS 3
+
+
+/* Return the length of the code at the top of the left-aligned 32-bit
+ * window `win', or zero if it is EOS.
+ */
+static inline unsigned
+hdec_canon_len (uint32_t win)
+{
+    /* `| 3' caps the count of leading 1 bits at HDEC_CANON_MAX_ONES */
+    const unsigned ones = __builtin_clz(~win | 3);
+
+    if (ones >= HDEC_CANON_MAX_ONES)
+        return 0;
+    return hdec_canon_len0[ones]
+         + (win >= hdec_canon_lim[ones][0])
+         + (win >= hdec_canon_lim[ones][1]);
+}
+
+
+/* Return the symbol of the `len'-bit code at the top of `win' */
+static inline unsigned char
+hdec_canon_sym (uint32_t win, unsigned len)
+{
+    return hdec_canon_syms[
+                        (int32_t) (win >> (32 - len)) + hdec_canon_base[len] ];
+}
+
+
+/* Decode the code at the top of the left-aligned `buf', of which
+ * `avail_bits' bits are input.  Bits past those are taken to be 1 bits.
+ * Places the symbol into `sym' and returns the length of the code, or
+ * zero if it is EOS or runs past the end of input.
+ */
+static inline unsigned
+hdec_canon_decode (uint64_t buf, unsigned avail_bits, unsigned char *sym)
+{
+    uint32_t win;
+    unsigned len;
+
+    win = buf >> 32;
+    if (avail_bits < 32)
+        win |= 0xFFFFFFFFu >> avail_bits;       /* EOF */
+    len = hdec_canon_len(win);
+    if (len == 0 || len > avail_bits)
+        return 0;
+    *sym = hdec_canon_sym(win, len);
+    return len;
+}
+
+
+/* One step near the end of input, where fewer than 16 bits may be left.
+ * Looks up the next `hdecs' entry, with the missing bits taken to be 1
+ * bits, and places it into `hdec'.  A code longer than 16 bits is decoded
+ * the canonical way into an entry of one symbol, whose other output bytes
+ * are zero as in `hdecs'.  `idx' is set to the index used; the `hdecs'
+ * entry at the index of a long code is empty.
+ *
+ * Returns the number of bits the step consumes, zero if only padding is
+ * left, or -1 if the input is not a valid Huffman string.
+ */
+static inline int
+hdec_canon_step (uint64_t buf, unsigned avail_bits, uint16_t *idx,
+                                                        struct hdec *hdec)
+{
+    unsigned len;
+
+    if (avail_bits == 0)
+        return 0;
+    *idx = buf >> 48;
+    if (avail_bits < 16)
+        *idx |= 0xFFFF >> avail_bits;           /* EOF */
+    if (*idx == 0xFFFF && avail_bits < 8)
+        return 0;                               /* Padding */
+    *hdec = hdecs[*idx];
+    if (hdec->lens)
+    {
+        /* A code that runs into the padding means that the padding is not
+         * all 1 bits.
+         */
+        if ((unsigned) (hdec->lens >> 2) > avail_bits)
+            return -1;
+        return hdec->lens >> 2;
+    }
+    len = hdec_canon_decode(buf, avail_bits, &hdec->out[0]);
+    if (len == 0)
+        return -1;
+    hdec->lens = len << 2 | 1;
+    hdec->out[1] = 0;
+    hdec->out[2] = 0;
+    return len;
+}
+
+#endif
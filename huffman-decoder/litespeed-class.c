@@ -0,0 +1,178 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+#include "litespeed-class-table.h"
+
+/* Classes that make a field name or value invalid */
+#define NAME_INVALID (HDEC_CLASS_UPPER | HDEC_CLASS_FORBIDDEN \
+                            | HDEC_CLASS_NONTOKEN | HDEC_CLASS_OBS_TEXT)
+#define VALUE_INVALID HDEC_CLASS_FORBIDDEN
+
+
+/* The decoder of lshpack_dec_huff_decode_class().  When `classes' is
+ * NULL, which the compiler sees at the call, the class lookups go away.
+ */
+static inline int
+class_decode (const unsigned char *src, int src_len, unsigned char *dst,
+                                            int dst_len, unsigned *classes)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf, word;     /* Left-aligned: next bit is the top bit */
+    unsigned avail_bits, len, step, class;
+    struct hdec hdec;
+    uint16_t idx;
+    int r;
+
+    buf = 0;
+    avail_bits = 0;
+    class = 0;
+
+    /* Fast path: a single load refills, and there is room for three
+     * steps' worth of output.
+     */
+    while (src + sizeof(word) <= src_end && dst_end - dst >= 3 * HDEC_STEPS)
+    {
+        memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        word = bswap_64(word);
+#endif
+        buf |= word >> avail_bits;
+        src += (63 - avail_bits) >> 3;
+        avail_bits |= 56;
+        if (!hdecs[ buf >> 48 ].lens)
+        {
+            len = hdec_canon_decode(buf, avail_bits, dst);
+            if (!len)
+                return -1;
+            if (classes)
+                class |= hdec_sym_class[*dst];
+            ++dst;
+            buf <<= len;
+            avail_bits -= len;
+            continue;
+        }
+        /* A step at a long code does nothing */
+        for (step = 0; step < HDEC_STEPS; ++step)
+        {
+            idx = buf >> 48;
+            hdec = hdecs[idx];
+            if (classes)
+                class |= hdec_class[idx];
+            dst[0] = hdec.out[0];
+            dst[1] = hdec.out[1];
+            dst[2] = hdec.out[2];
+            dst += hdec.lens & 3;
+            buf <<= hdec.lens >> 2;
+            avail_bits -= hdec.lens >> 2;
+        }
+    }
+
+    /* The last bytes of input or the last few bytes of output */
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (r == 0)
+            break;
+        if (dst_end - dst < (hdec.lens & 3))
+            return -2;
+        memcpy(dst, hdec.out, hdec.lens & 3);
+        /* The `hdec_class' entry of a long code is empty */
+        if (classes)
+            class |= hdec_class[idx] | hdec_sym_class[hdec.out[0]];
+        dst += hdec.lens & 3;
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    if (classes)
+        *classes = class;
+    return dst - orig_dst;
+}
+
+
+/* lshpack_dec_huff_decode() that also places into `classes' the union of
+ * the character classes (HDEC_CLASS_* in litespeed-class-table.h) of the
+ * decoded symbols.  Every `hdecs' lookup is paired with one from
+ * `hdec_class', whose entry covers all the symbols it emits, so checking
+ * the decoded string takes no second pass over it.  If `classes' is NULL,
+ * the string is only decoded.
+ *
+ * Input is read eight bytes at a time, as in litespeed-padded.c, while
+ * eight bytes are left; then one byte at a time.
+ */
+int
+lshpack_dec_huff_decode_class (const unsigned char *src, int src_len,
+                    unsigned char *dst, int dst_len, unsigned *classes)
+{
+    if (classes)
+        return class_decode(src, src_len, dst, dst_len, classes);
+    else
+        return class_decode(src, src_len, dst, dst_len, NULL);
+}
+
+
+/* Decode a field name, which RFC 9113, Section 8.2.1, requires to be a
+ * lowercase token.  A pseudo-header name is ':' followed by one.
+ *
+ * Returns the length of the name, -1 or -2 as lshpack_dec_huff_decode()
+ * does, or -3 if the name is not valid.
+ */
+int
+lshpack_dec_huff_decode_name (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned classes;
+    int len;
+
+    len = lshpack_dec_huff_decode_class(src, src_len, dst, dst_len, &classes);
+    if (len <= 0)
+        return len < 0 ? len : -3;
+    if (classes & NAME_INVALID)
+        return -3;
+    /* Only the first character may be ':'.  Pseudo-header names are short;
+     * looking for another one is cheap.
+     */
+    if ((classes & HDEC_CLASS_COLON)
+            && (dst[0] != ':' || len == 1 || memchr(dst + 1, ':', len - 1)))
+        return -3;
+    return len;
+}
+
+
+/* Decode a field value, which RFC 9113, Section 8.2.1, forbids to contain
+ * NUL, CR, or LF, or to start or end with whitespace.
+ *
+ * Returns the length of the value, -1 or -2 as lshpack_dec_huff_decode()
+ * does, or -3 if the value is not valid.
+ */
+int
+lshpack_dec_huff_decode_value (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned classes;
+    int len;
+
+    len = lshpack_dec_huff_decode_class(src, src_len, dst, dst_len, &classes);
+    if (len <= 0)
+        return len;
+    if ((classes & VALUE_INVALID)
+            || dst[0] == ' ' || dst[0] == '\t'
+            || dst[len - 1] == ' ' || dst[len - 1] == '\t')
+        return -3;
+    return len;
+}
@@ -0,0 +1,173 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+#include "litespeed-cookie-table.h"
+
+
+struct cookie_state
+{
+    unsigned       *crumbs;     /* Start offsets of crumbs */
+    unsigned        n_crumbs;
+    unsigned        max_crumbs;
+    unsigned        pending;    /* Two past the last ';', or zero */
+};
+
+
+/* The byte after the last ';' has been written, which is the case when
+ * another ';' or the end is reached.  If it is a space, a crumb starts
+ * after it.  Returns 0 or -2 if `crumbs' is full.
+ */
+static int
+cookie_check_pending (struct cookie_state *st,
+                    const unsigned char *orig_dst, const unsigned char *dst)
+{
+    unsigned off;
+
+    off = st->pending;
+    if (off && orig_dst + off <= dst && orig_dst[off - 1] == ' ')
+    {
+        if (st->n_crumbs >= st->max_crumbs)
+            return -2;
+        st->crumbs[st->n_crumbs++] = off;
+    }
+    st->pending = 0;
+    return 0;
+}
+
+
+/* The `hdecs' entry just written at `dst' emits a ';'.  Returns 0 or -2
+ * if `crumbs' is full.
+ */
+static int
+cookie_entry (struct cookie_state *st, const unsigned char *orig_dst,
+                                const unsigned char *dst, struct hdec hdec)
+{
+    unsigned i;
+
+    for (i = 0; i < (hdec.lens & 3u); ++i)
+        if (hdec.out[i] == ';')
+        {
+            if (0 != cookie_check_pending(st, orig_dst, dst + i))
+                return -2;
+            st->pending = dst + i + 2 - orig_dst;
+        }
+    return 0;
+}
+
+
+/* Decode a cookie header value and place into `crumbs' the offset at
+ * which each of its crumbs starts: the first at zero and one after each
+ * "; ", the delimiter of RFC 6265, Section 4.2.1, and RFC 9113, Section
+ * 8.2.3.  The caller splits the value without scanning it again.
+ *
+ * Entries of `hdecs' that emit ';' are marked in a bitmap, so other
+ * steps cost one more lookup.  Whether a space follows a ';' is checked
+ * when the next ';' is found or when decoding ends; by then the byte is
+ * in dst.
+ *
+ * On input, `n_crumbs' is the size of `crumbs'; on success, it is set to
+ * the number of crumbs.  An empty value has none, but `crumbs' must have
+ * room for one.  Returns the length of the value, or -1 or -2 as
+ * lshpack_dec_huff_decode() does.  -2 is also returned if there are more
+ * crumbs than `crumbs' has room for.
+ */
+int
+lshpack_dec_huff_decode_cookie (const unsigned char *src, int src_len,
+        unsigned char *dst, int dst_len, unsigned *crumbs, unsigned *n_crumbs)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf, word;     /* Left-aligned: next bit is the top bit */
+    unsigned avail_bits, len, step;
+    struct cookie_state st;
+    struct hdec hdec;
+    uint16_t idx;
+    int r;
+
+    buf = 0;
+    avail_bits = 0;
+    if (*n_crumbs == 0)
+        return -2;
+    crumbs[0] = 0;
+    st.crumbs = crumbs;
+    st.n_crumbs = 1;
+    st.max_crumbs = *n_crumbs;
+    st.pending = 0;
+
+    /* Fast path: a single load refills, and there is room for three
+     * steps' worth of output.
+     */
+    while (src + sizeof(word) <= src_end && dst_end - dst >= 3 * HDEC_STEPS)
+    {
+        memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        word = bswap_64(word);
+#endif
+        buf |= word >> avail_bits;
+        src += (63 - avail_bits) >> 3;
+        avail_bits |= 56;
+        if (!hdecs[ buf >> 48 ].lens)
+        {
+            /* No long code is ';' */
+            len = hdec_canon_decode(buf, avail_bits, dst);
+            if (!len)
+                return -1;
+            ++dst;
+            buf <<= len;
+            avail_bits -= len;
+            continue;
+        }
+        /* A step at a long code does nothing */
+        for (step = 0; step < HDEC_STEPS; ++step)
+        {
+            idx = buf >> 48;
+            hdec = hdecs[idx];
+            dst[0] = hdec.out[0];
+            dst[1] = hdec.out[1];
+            dst[2] = hdec.out[2];
+            if ((hdec_cookie_semi[idx >> 3] >> (idx & 7) & 1)
+                            && 0 != cookie_entry(&st, orig_dst, dst, hdec))
+                return -2;
+            dst += hdec.lens & 3;
+            buf <<= hdec.lens >> 2;
+            avail_bits -= hdec.lens >> 2;
+        }
+    }
+
+    /* The last bytes of input or the last few bytes of output */
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (r == 0)
+            break;
+        if (dst_end - dst < (hdec.lens & 3))
+            return -2;
+        memcpy(dst, hdec.out, hdec.lens & 3);
+        /* The bitmap has nothing for a long code, and no long code is ';' */
+        if ((hdec_cookie_semi[idx >> 3] >> (idx & 7) & 1)
+                        && 0 != cookie_entry(&st, orig_dst, dst, hdec))
+            return -2;
+        dst += hdec.lens & 3;
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    if (0 != cookie_check_pending(&st, orig_dst, dst))
+        return -2;
+    *n_crumbs = dst > orig_dst ? st.n_crumbs : 0;
+    return dst - orig_dst;
+}
@@ -0,0 +1,87 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+
+
+/* Return the length of the string `src' decodes to, or -1 if it is not a
+ * valid Huffman string.  This lets the caller allocate exactly as much as
+ * it needs and decode there instead of decoding into a worst-case scratch
+ * buffer and copying.  The walk is that of lshpack_dec_huff_validate():
+ * each step adds the `lens & 3' symbol count of its `hdecs' entry, and
+ * nothing is written.
+ *
+ * Note that lshpack_dec_huff_decode() may return -2 when the output fills
+ * dst exactly; decode into the exact-size buffer with
+ * lshpack_dec_huff_decode_2level().
+ */
+int
+lshpack_dec_huff_decoded_len (const unsigned char *src, int src_len)
+{
+    const unsigned char *const src_end = src + src_len;
+    uint64_t buf, word;     /* Left-aligned: next bit is the top bit */
+    unsigned avail_bits, len, step;
+    struct hdec hdec;
+    unsigned char sym;
+    uint16_t idx;
+    int count, r;
+
+    buf = 0;
+    avail_bits = 0;
+    count = 0;
+
+    /* While eight bytes of input are left, refill with a single load */
+    while (src + sizeof(word) <= src_end)
+    {
+        memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        word = bswap_64(word);
+#endif
+        buf |= word >> avail_bits;
+        src += (63 - avail_bits) >> 3;
+        avail_bits |= 56;
+        if (!hdecs[ buf >> 48 ].lens)
+        {
+            len = hdec_canon_decode(buf, avail_bits, &sym);
+            if (!len)
+                return -1;
+            ++count;
+            buf <<= len;
+            avail_bits -= len;
+            continue;
+        }
+        /* A step at a long code does nothing */
+        for (step = 0; step < HDEC_STEPS; ++step)
+        {
+            hdec = hdecs[ buf >> 48 ];
+            count += hdec.lens & 3;
+            buf <<= hdec.lens >> 2;
+            avail_bits -= hdec.lens >> 2;
+        }
+    }
+
+    /* The last bytes of input */
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (r == 0)
+            break;
+        count += hdec.lens & 3;
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    return count;
+}
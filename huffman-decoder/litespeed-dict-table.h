@@ -0,0 +1,319 @@
+/* Generated by `gen-tables dict'; do not edit. */
+
+/* A dictionary of common header names and values, each with its Huffman
+ * encoding, and two perfect hash tables: one for the encoded strings and
+ * one for the strings themselves.  A key, see dict_key(), multiplied by
+ * the seed gives the slot in its top HDEC_DICT_BITS bits.  Slots hold the
+ * index in hdec_dict plus one, or zero.
+ */
+#define HDEC_DICT_COUNT 159
+#define HDEC_DICT_BITS 10
+#define HDEC_DICT_MAX_ENC 26
+#define HDEC_DICT_ENC_SEED 0xBD3B43DE95956CB1ull
+#define HDEC_DICT_PLAIN_SEED 0xB85A6B61203F2069ull
+
+struct hdec_dict_el
+{
+    const char     *str;
+    uint8_t         len, enc_len;
+    unsigned char   enc[HDEC_DICT_MAX_ENC];
+};
+
+static const struct hdec_dict_el hdec_dict[159] =
+{
+    { ":authority", 10, 8, { 0xB8, 0x3B, 0x53, 0x39, 0xEC, 0x32, 0x7D, 0x7F, }, },
+    { ":method", 7, 5, { 0xB9, 0x49, 0x53, 0x39, 0xE4, }, },
+    { ":path", 5, 4, { 0xB9, 0x58, 0xD3, 0x3F, }, },
+    { ":scheme", 7, 5, { 0xB8, 0x82, 0x4E, 0x5A, 0x4B, }, },
+    { ":status", 7, 5, { 0xB8, 0x84, 0x8D, 0x36, 0xA3, }, },
+    { "accept-charset", 14, 10, { 0x19, 0x08, 0x5A, 0xD2, 0xB1, 0x27, 0x1D, 0x88, 0x2A, 0x7F, }, },
+    { "accept-encoding", 15, 11, { 0x19, 0x08, 0x5A, 0xD2, 0xB1, 0x6A, 0x21, 0xE4, 0x35, 0x53, 0x7F, }, },
+    { "accept-language", 15, 11, { 0x19, 0x08, 0x5A, 0xD2, 0xB5, 0x03, 0xAA, 0x6B, 0x47, 0x31, 0x7F, }, },
+    { "accept-ranges", 13, 9, { 0x19, 0x08, 0x5A, 0xD2, 0xB5, 0x83, 0xAA, 0x62, 0xA3, }, },
+    { "accept", 6, 4, { 0x19, 0x08, 0x5A, 0xD3, }, },
+    { "access-control-allow-origin", 27, 19, { 0x19, 0x08, 0x54, 0x21, 0x62, 0x1E, 0xA4, 0xD8, 0x7A, 0x16, 0x1D, 0x14, 0x1F, 0xC2, 0xC7, 0xB0, 0xD3, 0x1A, 0xAF, }, },
+    { "age", 3, 2, { 0x1C, 0xC5, }, },
+    { "allow", 5, 4, { 0x1D, 0x14, 0x1F, 0xC7, }, },
+    { "authorization", 13, 9, { 0x1D, 0xA9, 0x9C, 0xF6, 0x1B, 0xD8, 0xD2, 0x63, 0xD5, }, },
+    { "cache-control", 13, 9, { 0x20, 0xC9, 0x39, 0x56, 0x21, 0xEA, 0x4D, 0x87, 0xA3, }, },
+    { "content-disposition", 19, 13, { 0x21, 0xEA, 0x49, 0x6A, 0x4A, 0xD2, 0x19, 0x15, 0x9D, 0x06, 0x49, 0x8F, 0x57, }, },
+    { "content-encoding", 16, 11, { 0x21, 0xEA, 0x49, 0x6A, 0x4A, 0xC5, 0xA8, 0x87, 0x90, 0xD5, 0x4D, }, },
+    { "content-language", 16, 11, { 0x21, 0xEA, 0x49, 0x6A, 0x4A, 0xD4, 0x0E, 0xA9, 0xAD, 0x1C, 0xC5, }, },
+    { "content-length", 14, 10, { 0x21, 0xEA, 0x49, 0x6A, 0x4A, 0xD4, 0x16, 0xA9, 0x93, 0x3F, }, },
+    { "content-location", 16, 11, { 0x21, 0xEA, 0x49, 0x6A, 0x4A, 0xD4, 0x1C, 0x83, 0x49, 0x8F, 0x57, }, },
+    { "content-range", 13, 9, { 0x21, 0xEA, 0x49, 0x6A, 0x4A, 0xD6, 0x0E, 0xA9, 0x8B, }, },
+    { "content-type", 12, 9, { 0x21, 0xEA, 0x49, 0x6A, 0x4A, 0xC9, 0xF5, 0x59, 0x7F, }, },
+    { "cookie", 6, 4, { 0x21, 0xCF, 0xD4, 0xC5, }, },
+    { "date", 4, 3, { 0x90, 0x69, 0x2F, }, },
+    { "etag", 4, 3, { 0x2A, 0x47, 0x37, }, },
+    { "expect", 6, 5, { 0x2F, 0x9A, 0xCA, 0x44, 0xFF, }, },
+    { "expires", 7, 5, { 0x2F, 0x9A, 0xCD, 0x61, 0x51, }, },
+    { "from", 4, 3, { 0x96, 0xC3, 0xD3, }, },
+    { "host", 4, 3, { 0x9C, 0xE8, 0x4F, }, },
+    { "if-match", 8, 6, { 0x34, 0xAB, 0x52, 0x34, 0x92, 0x7F, }, },
+    { "if-modified-since", 17, 12, { 0x34, 0xAB, 0x52, 0x79, 0x0D, 0x29, 0x8B, 0x22, 0xC8, 0x35, 0x44, 0x2F, }, },
+    { "if-none-match", 13, 9, { 0x34, 0xAB, 0x54, 0x7A, 0x8A, 0xB5, 0x23, 0x49, 0x27, }, },
+    { "if-range", 8, 6, { 0x34, 0xAB, 0x58, 0x3A, 0xA6, 0x2F, }, },
+    { "if-unmodified-since", 19, 14, { 0x34, 0xAB, 0x5B, 0x55, 0x27, 0x90, 0xD2, 0x98, 0xB2, 0x2C, 0x83, 0x54, 0x42, 0xFF, }, },
+    { "last-modified", 13, 9, { 0xA0, 0x68, 0x4A, 0xD4, 0x9E, 0x43, 0x4A, 0x62, 0xC9, }, },
+    { "link", 4, 3, { 0xA0, 0xD5, 0x75, }, },
+    { "location", 8, 6, { 0xA0, 0xE4, 0x1A, 0x4C, 0x7A, 0xBF, }, },
+    { "max-forwards", 12, 9, { 0xA4, 0x7E, 0x56, 0x94, 0xF6, 0x78, 0x1D, 0x92, 0x23, }, },
+    { "proxy-authenticate", 18, 13, { 0xAE, 0xC3, 0xF9, 0xF4, 0xB0, 0xED, 0x4C, 0xE5, 0xA9, 0x26, 0x20, 0xD2, 0x5F, }, },
+    { "proxy-authorization", 19, 14, { 0xAE, 0xC3, 0xF9, 0xF4, 0xB0, 0xED, 0x4C, 0xE7, 0xB0, 0xDE, 0xC6, 0x93, 0x1E, 0xAF, }, },
+    { "range", 5, 4, { 0xB0, 0x75, 0x4C, 0x5F, }, },
+    { "referer", 7, 5, { 0xB0, 0xB2, 0x96, 0xC2, 0xD9, }, },
+    { "refresh", 7, 5, { 0xB0, 0xB2, 0xD8, 0x54, 0x4F, }, },
+    { "retry-after", 11, 8, { 0xB0, 0xA9, 0xB3, 0xD2, 0xC3, 0x95, 0x25, 0xB3, }, },
+    { "server", 6, 5, { 0x41, 0x6C, 0xEE, 0x5B, 0x3F, }, },
+    { "set-cookie", 10, 7, { 0x41, 0x52, 0xB1, 0x0E, 0x7E, 0xA6, 0x2F, }, },
+    { "strict-transport-security", 25, 17, { 0x42, 0x6C, 0x31, 0x12, 0xB2, 0x6C, 0x1D, 0x48, 0xAC, 0xF6, 0x25, 0x64, 0x14, 0x96, 0xD8, 0x64, 0xFA, }, },
+    { "transfer-encoding", 17, 12, { 0x4D, 0x83, 0xA9, 0x12, 0x96, 0xC5, 0x8B, 0x51, 0x0F, 0x21, 0xAA, 0x9B, }, },
+    { "user-agent", 10, 7, { 0xB5, 0x05, 0xB1, 0x61, 0xCC, 0x5A, 0x93, }, },
+    { "vary", 4, 4, { 0xEE, 0x3B, 0x3D, 0x7F, }, },
+    { "via", 3, 3, { 0xEE, 0x61, 0xFF, }, },
+    { "www-authenticate", 16, 12, { 0xF1, 0xE3, 0xC2, 0xC3, 0xB5, 0x33, 0x96, 0xA4, 0x98, 0x83, 0x49, 0x7F, }, },
+    { "GET", 3, 3, { 0xC5, 0x83, 0x7F, }, },
+    { "POST", 4, 4, { 0xD7, 0xAB, 0x76, 0xFF, }, },
+    { "/", 1, 1, { 0x63, }, },
+    { "/index.html", 11, 8, { 0x60, 0xD5, 0x48, 0x5F, 0x2B, 0xCE, 0x9A, 0x68, }, },
+    { "http", 4, 3, { 0x9D, 0x29, 0xAF, }, },
+    { "https", 5, 4, { 0x9D, 0x29, 0xAD, 0x1F, }, },
+    { "200", 3, 2, { 0x10, 0x01, }, },
+    { "204", 3, 2, { 0x10, 0x1A, }, },
+    { "206", 3, 2, { 0x10, 0x1C, }, },
+    { "304", 3, 3, { 0x64, 0x0D, 0x7F, }, },
+    { "400", 3, 2, { 0x68, 0x00, }, },
+    { "404", 3, 3, { 0x68, 0x0D, 0x7F, }, },
+    { "500", 3, 2, { 0x6C, 0x00, }, },
+    { "gzip, deflate", 13, 10, { 0x9B, 0xD9, 0xAB, 0xFA, 0x52, 0x42, 0xCB, 0x40, 0xD2, 0x5F, }, },
+    { "access-control-allow-credentials", 32, 22, { 0x19, 0x08, 0x54, 0x21, 0x62, 0x1E, 0xA4, 0xD8, 0x7A, 0x16, 0x1D, 0x14, 0x1F, 0xC2, 0xC4, 0xB0, 0xB2, 0x16, 0xA4, 0x98, 0x74, 0x23, }, },
+    { "access-control-allow-headers", 28, 20, { 0x19, 0x08, 0x54, 0x21, 0x62, 0x1E, 0xA4, 0xD8, 0x7A, 0x16, 0x1D, 0x14, 0x1F, 0xC2, 0xD3, 0x94, 0x72, 0x16, 0xC4, 0x7F, }, },
+    { "access-control-allow-methods", 28, 20, { 0x19, 0x08, 0x54, 0x21, 0x62, 0x1E, 0xA4, 0xD8, 0x7A, 0x16, 0x1D, 0x14, 0x1F, 0xC2, 0xD4, 0x95, 0x33, 0x9E, 0x44, 0x7F, }, },
+    { "access-control-expose-headers", 29, 20, { 0x19, 0x08, 0x54, 0x21, 0x62, 0x1E, 0xA4, 0xD8, 0x7A, 0x16, 0x2F, 0x9A, 0xCE, 0x82, 0xAD, 0x39, 0x47, 0x21, 0x6C, 0x47, }, },
+    { "access-control-request-headers", 30, 21, { 0x19, 0x08, 0x54, 0x21, 0x62, 0x1E, 0xA4, 0xD8, 0x7A, 0x16, 0xB0, 0xBD, 0xAD, 0x2A, 0x12, 0xB4, 0xE5, 0x1C, 0x85, 0xB1, 0x1F, }, },
+    { "access-control-request-method", 29, 20, { 0x19, 0x08, 0x54, 0x21, 0x62, 0x1E, 0xA4, 0xD8, 0x7A, 0x16, 0xB0, 0xBD, 0xAD, 0x2A, 0x12, 0xB5, 0x25, 0x4C, 0xE7, 0x93, }, },
+    { "alt-svc", 7, 5, { 0x1D, 0x09, 0x59, 0x1D, 0xC9, }, },
+    { "content-security-policy", 23, 16, { 0x21, 0xEA, 0x49, 0x6A, 0x4A, 0xC8, 0x29, 0x2D, 0xB0, 0xC9, 0xF4, 0xB5, 0x67, 0xA0, 0xC4, 0xF5, }, },
+    { "early-data", 10, 7, { 0x28, 0xEC, 0xA3, 0xD2, 0xD2, 0x0D, 0x23, }, },
+    { "expect-ct", 9, 7, { 0x2F, 0x9A, 0xCA, 0x44, 0xAC, 0x44, 0xFF, }, },
+    { "forwarded", 9, 7, { 0x94, 0xF6, 0x78, 0x1D, 0x92, 0x16, 0x4F, }, },
+    { "origin", 6, 5, { 0x3D, 0x86, 0x98, 0xD5, 0x7F, }, },
+    { "purpose", 7, 5, { 0xAE, 0xDB, 0x2B, 0x3A, 0x0B, }, },
+    { "sec-ch-ua", 9, 7, { 0x41, 0x48, 0xB1, 0x27, 0x5A, 0xD1, 0xFF, }, },
+    { "sec-ch-ua-mobile", 16, 11, { 0x41, 0x48, 0xB1, 0x27, 0x5A, 0xD1, 0xAD, 0x49, 0xE3, 0x35, 0x05, }, },
+    { "sec-ch-ua-platform", 18, 13, { 0x41, 0x48, 0xB1, 0x27, 0x5A, 0xD1, 0xAD, 0x5D, 0x03, 0x4C, 0xA7, 0xB2, 0x9F, }, },
+    { "sec-fetch-dest", 14, 10, { 0x41, 0x48, 0xB4, 0xA5, 0x49, 0x27, 0x5A, 0x42, 0xA1, 0x3F, }, },
+    { "sec-fetch-mode", 14, 10, { 0x41, 0x48, 0xB4, 0xA5, 0x49, 0x27, 0x5A, 0x93, 0xC8, 0x5F, }, },
+    { "sec-fetch-site", 14, 10, { 0x41, 0x48, 0xB4, 0xA5, 0x49, 0x27, 0x59, 0x06, 0x49, 0x7F, }, },
+    { "sec-fetch-user", 14, 10, { 0x41, 0x48, 0xB4, 0xA5, 0x49, 0x27, 0x5A, 0xD4, 0x16, 0xCF, }, },
+    { "te", 2, 2, { 0x49, 0x7F, }, },
+    { "timing-allow-origin", 19, 14, { 0x49, 0xA9, 0x35, 0x53, 0x2C, 0x3A, 0x28, 0x3F, 0x85, 0x8F, 0x61, 0xA6, 0x35, 0x5F, }, },
+    { "upgrade-insecure-requests", 25, 18, { 0xB6, 0xB9, 0xAC, 0x1C, 0x85, 0x58, 0xD5, 0x20, 0xA4, 0xB6, 0xC2, 0xAD, 0x61, 0x7B, 0x5A, 0x54, 0x25, 0x1F, }, },
+    { "x-content-type-options", 22, 16, { 0xF2, 0xB1, 0x0F, 0x52, 0x4B, 0x52, 0x56, 0x4F, 0xAA, 0xCA, 0xB1, 0xEB, 0x49, 0x8F, 0x52, 0x3F, }, },
+    { "x-forwarded-for", 15, 11, { 0xF2, 0xB4, 0xA7, 0xB3, 0xC0, 0xEC, 0x90, 0xB2, 0x2D, 0x29, 0xEC, }, },
+    { "x-frame-options", 15, 11, { 0xF2, 0xB4, 0xB6, 0x0E, 0x92, 0xAC, 0x7A, 0xD2, 0x63, 0xD4, 0x8F, }, },
+    { "x-requested-with", 16, 12, { 0xF2, 0xB5, 0x85, 0xED, 0x69, 0x50, 0x92, 0xC8, 0xB7, 0x83, 0x26, 0x7F, }, },
+    { "x-xss-protection", 16, 12, { 0xF2, 0xB7, 0x94, 0x21, 0x6A, 0xEC, 0x3A, 0x4A, 0x44, 0x98, 0xF5, 0x7F, }, },
+    { "pragma", 6, 5, { 0xAE, 0xC1, 0xCD, 0x48, 0xFF, }, },
+    { "priority", 8, 6, { 0xAE, 0xC3, 0x1E, 0xC3, 0x27, 0xD7, }, },
+    { "gzip, deflate, br", 17, 13, { 0x9B, 0xD9, 0xAB, 0xFA, 0x52, 0x42, 0xCB, 0x40, 0xD2, 0x5F, 0xA5, 0x23, 0xB3, }, },
+    { "gzip", 4, 3, { 0x9B, 0xD9, 0xAB, }, },
+    { "br", 2, 2, { 0x8E, 0xCF, }, },
+    { "deflate", 7, 5, { 0x90, 0xB2, 0xD0, 0x34, 0x97, }, },
+    { "identity", 8, 6, { 0x34, 0x85, 0xA9, 0x26, 0x4F, 0xAF, }, },
+    { "trailers", 8, 6, { 0x4D, 0x83, 0x35, 0x05, 0xB1, 0x1F, }, },
+    { "*/*", 3, 3, { 0xF9, 0x63, 0xE7, }, },
+    { "*", 1, 1, { 0xF9, }, },
+    { "bytes", 5, 4, { 0x8F, 0xD2, 0x4A, 0x8F, }, },
+    { "no-cache", 8, 6, { 0xA8, 0xEB, 0x10, 0x64, 0x9C, 0xBF, }, },
+    { "no-store", 8, 6, { 0xA8, 0xEB, 0x21, 0x27, 0xB0, 0xBF, }, },
+    { "private", 7, 5, { 0xAE, 0xC3, 0x77, 0x1A, 0x4B, }, },
+    { "public", 6, 5, { 0xAE, 0xD8, 0xE8, 0x31, 0x3F, }, },
+    { "max-age=0", 9, 7, { 0xA4, 0x7E, 0x56, 0x1C, 0xC5, 0x80, 0x1F, }, },
+    { "max-age=31536000", 16, 12, { 0xA4, 0x7E, 0x56, 0x1C, 0xC5, 0x81, 0x90, 0xB6, 0xCB, 0x80, 0x00, 0x3F, }, },
+    { "max-age=31536000; includeSubDomains", 35, 26, { 0xA4, 0x7E, 0x56, 0x1C, 0xC5, 0x81, 0x90, 0xB6, 0xCB, 0x80, 0x00, 0x3E, 0xD4, 0x35, 0x44, 0xA2, 0xD9, 0x0B, 0xBA, 0xD8, 0xEF, 0x9E, 0x91, 0x9A, 0xA4, 0x7F, }, },
+    { "nosniff", 7, 5, { 0xA8, 0xE8, 0xA8, 0xD2, 0xCB, }, },
+    { "DENY", 4, 4, { 0xBF, 0x83, 0x4F, 0x3F, }, },
+    { "SAMEORIGIN", 10, 9, { 0xDD, 0x0E, 0x8C, 0x1A, 0xB6, 0xE4, 0xC5, 0x93, 0x4F, }, },
+    { "1; mode=block", 13, 10, { 0x0F, 0xDA, 0x94, 0x9E, 0x42, 0xC1, 0x1D, 0x07, 0x27, 0x5F, }, },
+    { "?0", 2, 2, { 0xFF, 0x01, }, },
+    { "?1", 2, 2, { 0xFF, 0x03, }, },
+    { "1", 1, 1, { 0x0F, }, },
+    { "navigate", 8, 6, { 0xA8, 0x7D, 0xCD, 0x30, 0xD2, 0x5F, }, },
+    { "cors", 4, 3, { 0x21, 0xEC, 0x47, }, },
+    { "no-cors", 7, 5, { 0xA8, 0xEB, 0x10, 0xF6, 0x23, }, },
+    { "same-origin", 11, 8, { 0x40, 0xE9, 0x2A, 0xC7, 0xB0, 0xD3, 0x1A, 0xAF, }, },
+    { "same-site", 9, 6, { 0x40, 0xE9, 0x2A, 0xC8, 0x32, 0x4B, }, },
+    { "cross-site", 10, 7, { 0x25, 0x87, 0x42, 0x16, 0x41, 0x92, 0x5F, }, },
+    { "none", 4, 3, { 0xA8, 0xF5, 0x17, }, },
+    { "document", 8, 6, { 0x90, 0xE4, 0xB6, 0x92, 0xD4, 0x9F, }, },
+    { "empty", 5, 4, { 0x2D, 0x35, 0xA7, 0xD7, }, },
+    { "script", 6, 4, { 0x41, 0x2C, 0x35, 0x69, }, },
+    { "style", 5, 4, { 0x42, 0x7D, 0x50, 0x5F, }, },
+    { "image", 5, 4, { 0x35, 0x23, 0x98, 0xBF, }, },
+    { "text/html", 9, 7, { 0x49, 0x7C, 0xA5, 0x89, 0xD3, 0x4D, 0x1F, }, },
+    { "text/html; charset=utf-8", 24, 18, { 0x49, 0x7C, 0xA5, 0x89, 0xD3, 0x4D, 0x1F, 0x6A, 0x12, 0x71, 0xD8, 0x82, 0xA6, 0x0B, 0x53, 0x2A, 0xCF, 0x7F, }, },
+    { "text/html; charset=UTF-8", 24, 18, { 0x49, 0x7C, 0xA5, 0x89, 0xD3, 0x4D, 0x1F, 0x6A, 0x12, 0x71, 0xD8, 0x82, 0xA6, 0x0E, 0x1B, 0xF0, 0xAC, 0xF7, }, },
+    { "text/plain", 10, 7, { 0x49, 0x7C, 0xA5, 0x8A, 0xE8, 0x19, 0xAA, }, },
+    { "text/css", 8, 6, { 0x49, 0x7C, 0xA5, 0x82, 0x21, 0x1F, }, },
+    { "text/javascript", 15, 11, { 0x49, 0x7C, 0xA5, 0x8E, 0x83, 0xEE, 0x34, 0x12, 0xC3, 0x56, 0x9F, }, },
+    { "application/json", 16, 11, { 0x1D, 0x75, 0xD0, 0x62, 0x0D, 0x26, 0x3D, 0x4C, 0x74, 0x41, 0xEA, }, },
+    { "application/javascript", 22, 16, { 0x1D, 0x75, 0xD0, 0x62, 0x0D, 0x26, 0x3D, 0x4C, 0x74, 0x1F, 0x71, 0xA0, 0x96, 0x1A, 0xB4, 0xFF, }, },
+    { "application/x-www-form-urlencoded", 33, 24, { 0x1D, 0x75, 0xD0, 0x62, 0x0D, 0x26, 0x3D, 0x4C, 0x79, 0x5B, 0xC7, 0x8F, 0x0B, 0x4A, 0x7B, 0x29, 0x5A, 0xDB, 0x28, 0x2D, 0x44, 0x3C, 0x85, 0x93, }, },
+    { "image/png", 9, 7, { 0x35, 0x23, 0x98, 0xAC, 0x57, 0x54, 0xDF, }, },
+    { "image/jpeg", 10, 8, { 0x35, 0x23, 0x98, 0xAC, 0x74, 0xAC, 0xB3, 0x7F, }, },
+    { "image/gif", 9, 7, { 0x35, 0x23, 0x98, 0xAC, 0x4C, 0x69, 0x7F, }, },
+    { "image/webp", 10, 8, { 0x35, 0x23, 0x98, 0xAC, 0x78, 0x2C, 0x75, 0xFF, }, },
+    { "image/svg+xml", 13, 11, { 0x35, 0x23, 0x98, 0xAC, 0x23, 0xBC, 0xDF, 0xEF, 0xCD, 0x34, 0x7F, }, },
+    { "en-US,en;q=0.9", 14, 11, { 0x2D, 0x4B, 0x70, 0xDD, 0xF4, 0x5A, 0xBE, 0xFB, 0x40, 0x05, 0xDF, }, },
+    { "u=0, i", 6, 5, { 0xB6, 0x00, 0x7D, 0x28, 0x6F, }, },
+    { "u=1", 3, 3, { 0xB6, 0x00, 0xFF, }, },
+    { "HEAD", 4, 4, { 0xC7, 0x82, 0x1B, 0xFF, }, },
+    { "PUT", 3, 3, { 0xD7, 0xC3, 0x7F, }, },
+    { "DELETE", 6, 6, { 0xBF, 0x83, 0x3E, 0x0D, 0xF8, 0x3F, }, },
+    { "OPTIONS", 7, 7, { 0xD5, 0xAF, 0x7E, 0x4D, 0x5A, 0x77, 0x7F, }, },
+    { "301", 3, 2, { 0x64, 0x01, }, },
+    { "302", 3, 2, { 0x64, 0x02, }, },
+    { "403", 3, 3, { 0x68, 0x0C, 0xFF, }, },
+    { "503", 3, 3, { 0x6C, 0x0C, 0xFF, }, },
+    { "LiteSpeed", 9, 7, { 0xCE, 0x64, 0x97, 0x75, 0x65, 0x2C, 0x9F, }, },
+    { "hit", 3, 2, { 0x9C, 0xC9, }, },
+    { "miss", 4, 3, { 0xA4, 0xC8, 0x47, }, },
+};
+
+static const uint8_t hdec_dict_enc_slots[1024] =
+{
+      0, 108,   0,   0,   0,   0,   0,   0,   0,   0,   0,  52,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  85,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, 149,   0,   0,  60,   0,   0,   0,   7,
+      0,   0,  98,   0,   0,   0,   0,   0,   0, 145,   0,   0,  61,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,  71,   0,   0,   0,   0,  23,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   2,   0,   0,   0, 106,   0,   0,   0,   0,   0,
+    143,   0,   0,   0,   0,  70,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  20,   0,  74,   0,   0,   0,   0,   0,
+      0,   0,  11,  89,   0,   0,   0,   0,   0, 102, 126,   0,   0,   0,   0,   0,
+      0,  62,   0,   0,   0,  99,   0,   0,   0,   0,   0,  26,  51,   0,   0,   0,
+      0,   0,   0, 115,   0,   0,   0,   0,   0,   0,   0,  87,   0,   0,  57,   0,
+      0,  90,   0,  49,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  96, 142,   0,   0,   0,   0,   0,  76,   0,
+      0,   0,   0,   0,  30,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0, 136,   0, 155,   0,   0,   0,   0,   0,   0,   0,  82,
+      0,   0,   0,  28,   0,   0,   0,   1, 140,   0,   0,   0,   0,   0,   0,  92,
+      0,   0,  95,   0,   0,   0,   0,   0,   0, 104,   0, 158,   0,   0,   0,   0,
+    101, 129,   0,  84,   0, 157,   0,   0,   0,   0,   0, 151,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  88,   0,   0,   0,   0,   0,   0,   0,   0,   0,  29,
+      0,   0,   0, 138,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  48,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0, 113,   0,   0,   0,  91,   0,   0,   0,  46,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  39,   0,   0, 134,   0,   0,   0,  83,   0,   0,   0,  17,
+      0,   0,   0,   0, 121,   0,   0,   0,   0,  54,   3,   0,   0,  55,   0,   0,
+      0,   0,  97,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  50,  93,  66,   0,
+      0,   0,   0,   0, 114,   0,  33,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  14,   0,   0,   0,   0,   0,   0,  75,   0,   0,  12,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     34, 117,  56,   0,   0,   0, 122,   0,   0,   0,  64,   0,   8,   0,   0,   0,
+      0,   0, 118,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  47,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  86,   0,   0,   0,   0,  32, 112,   0,   0,
+      0,   0,   0,   0,   0,  25,   0,   0,   0,   0,   0, 141,   0,   0,   0,   0,
+    144,   0,   0,   0,   0,   0,   0,   0, 125,   0, 128, 103,   0,   0,  78,   0,
+      0,   0,   0,   0,   0,   0,  65, 150,   0,  27,   0,   0,   0,   0,   0,  38,
+    156,   0,   0,   0,   0,   0,  45,  24,   0,   0,   0,  77,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  69,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,  72, 119,   0,   0,   0,   0,   0,  68,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, 116,   0,   0,   0,   0,   0,   4,  18,
+      0,  94,  42,   0,   0,   0,   0,   0,   0, 130,   0,   0,   0,   0,  44,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 131,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 110,   0,   0,   0,   0,   0,
+      0,   0,   0,  67,   0,  36,   0,   0,  53,   0,  31,   0,   0,   0,   0,  19,
+      0,   0,   0,   0,  13,   0, 123,   0,   0,   6,   0,   0,   0,   0,   0,  80,
+     16,   0, 105,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0, 111,   9,   0,   0,  43,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     35,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0, 127,   0,   0,   0,   0, 120,   0,   0,   0,   0,   0,
+      0,   5,   0, 124,   0, 100,   0,   0,   0,   0,   0,   0,  22,   0,   0, 139,
+      0,   0,   0,   0,  15,   0,   0,   0,   0,   0, 147,   0,   0,   0,   0,   0,
+    148,   0,   0,   0,   0,   0,   0,  59,   0,   0,   0,   0,   0,   0,   0,   0,
+      0, 152,   0,   0,   0,   0,   0,  79,   0,   0,   0,   0,   0,  81,   0,   0,
+      0,  37, 146,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 135,   0,
+      0,   0,   0,   0,   0,   0, 133,   0,   0,   0,   0,   0,   0,   0,  21,   0,
+     40,   0, 107,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 153,   0,   0,   0,   0,
+      0,   0,   0,   0, 154, 159,   0,   0,   0,   0,   0,   0,   0,   0, 137,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  58,   0,   0,   0,  73,   0, 109,   0,   0,   0,   0,
+     41,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  10,   0,
+      0,   0,   0,   0, 132,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+static const uint8_t hdec_dict_plain_slots[1024] =
+{
+      0, 100,   0, 155,  62,  80,   0, 129, 146,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  36,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  27,   0,   0,   0,   0,   0,   0,   0,   0,  40,   0,   0, 127,   0,
+      0,   0,   0,   0,  45, 106,   0,   0,   0,   0,   0,  42,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, 115,   0,   0,   0, 145,   0,   0,   0,
+      0, 138,   0,   0,   0,   0,   0,   0, 113,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  39,  26,   0,   0,  35,   0, 140,   0,   0,
+      0,   0,   0,   0,   0,   0,   0, 143,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  68,   0, 156,  64,  61,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0, 148,  84,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0, 119,   0,  55,   0,   0,  81,   0,  17,   0,   0,
+      0,   0,   0,   0,  86,   0,   0,   0,  51, 122,   0,   0,   0,   0,   0,   0,
+    102,   0,   0,  98, 136,   0, 133,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,  57,   0,   0,   0,   0,   0,   0,   8,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   9,   0,   0,   0,   0,   0,   0,   5,
+      0,   0,   0, 121,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,  58,   0,   0,   0,   0,   0,   0, 117,   0,   0,  47,   0,  82,   0,   0,
+      0,   0,   0,   0,   0,   0,  75,   0,   0,   0, 131,   0,   0,   0,   0,  92,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     99,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,  30,  67,   0,   0,   0,  89,   0,   0, 103, 123,
+      0,   0,   0,   0,  76,   0,   0,   0, 149,   0,   0,   0,  59,   0, 128,   0,
+      0,   0,  66, 137,   0,   0,  88,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 139,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,  46,
+      0,   0, 109,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  72,   0,   0,
+    130,   0,   0,  74,  25,   0,  93,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,  85,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,  28,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  21,   0,   0,   0,   0,   0,
+      4,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  15,   0,
+      0,  13,   0,   0,   0, 108,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0, 152,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  96,   0,
+    124,   0,  23,   0,   0,   0,   0,   0,   0, 105,   0,   0,  43,   0,   0,   0,
+      0,  12,   0,   0,   0,  71,   0,   0,   0,   0,   0,   0,   0, 151, 126,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 147,   0,   0,   0,
+      0,   2,  54,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  34,   0,   0,   0,   0,   0,   0,  63, 153,
+      0,   0,   0,   0,   0,   0,   0,   0,  38,   0,   0,  83,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0, 116,   0,   0,  77, 118,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  48,   1,   0,   0, 112,   0, 104,   0,   0,
+      0,   0, 157,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  90,   0,   0,   0,   0,   0,   0,   0,  56,   0,   0,   0,   0,   0,
+      0,   0,   0,  78,   0,   0,   0,   0,   0,   0,   0, 107,   0,   0,   0,   0,
+    101,   0,   0,  20,   0,   0,   0,   0,   0,   0,  87,   0,   0,   0,   0,  65,
+    154,   0,   0,  53,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 142,   0,
+      0,   0,   0,   0,   0,   0, 141,   0,   0,   0,   0,   0, 135,   0,   0,   0,
+      0,   0,   0,   0,  79,   0,   0,   0,   0,  44,   0,   0,   0,   0,   0,  22,
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 132,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,  95,   0,  33,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0, 150,   0,   0,  29,   0,   0, 158,  41,  11,   0,   0,   0,
+      0,   0,   0,  70,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,  18, 134,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,  97,   0,  60,   6,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  31,   0,   0,  16,   0,   0,   0, 114,   0,   0,   0,   0,
+     69,  52,   0,   0,   0,  73,   0,   0,   0,   0, 159,   0,   0, 144,  32,   0,
+      0,   0,  50,   0,  14,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   7,   0,   0, 120,   0,   0,
+      0,   0,   0,   0,  49,   0,   0,   0, 111,   0,   0,  94,   0,   0,   0,   0,
+     37,   0,   0,  19,   0,  91,   0,   0,   0,   0,   0,   0,   0,   0,   0, 110,
+     10,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  24,   0,   0,   0, 125,
+};
@@ -0,0 +1,89 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-dict-table.h"
+
+
+/* The key of a string: its length and its first and last four bytes.
+ * This must match dict_key() in gen-tables.c.
+ */
+static inline uint64_t
+dict_key (const unsigned char *s, unsigned len)
+{
+    uint32_t a, b;
+
+    if (len >= 4)
+    {
+        memcpy(&a, s, 4);
+        memcpy(&b, s + len - 4, 4);
+    }
+    else if (len > 0)
+    {
+        a = s[0] | s[len >> 1] << 8 | s[len - 1] << 16;
+        b = 0;
+    }
+    else
+        a = b = 0;
+    return ((uint64_t) a << 32 | b) ^ len;
+}
+
+
+/* Look up a Huffman-encoded string in the dictionary of common header
+ * names and values (see gen-tables.c) without decoding it.  The RFC 7541
+ * code is canonical and valid padding is fewer than eight 1 bits, so a
+ * string has only one valid encoding: the encoded bytes are equal exactly
+ * when the strings are.  An invalid encoding is never equal to a
+ * dictionary entry and is simply not found.
+ *
+ * Returns the index of the string in the dictionary, or -1 if it is not
+ * there.
+ */
+int
+lshpack_dec_huff_match (const unsigned char *src, int src_len)
+{
+    const struct hdec_dict_el *el;
+    unsigned slot;
+
+    slot = (dict_key(src, src_len) * HDEC_DICT_ENC_SEED)
+                                                    >> (64 - HDEC_DICT_BITS);
+    if (!hdec_dict_enc_slots[slot])
+        return -1;
+    el = &hdec_dict[ hdec_dict_enc_slots[slot] - 1 ];
+    if (el->enc_len != src_len || 0 != memcmp(el->enc, src, src_len))
+        return -1;
+    return el - hdec_dict;
+}
+
+
+/* Look up a string that is not Huffman-encoded, or has been decoded, in
+ * the same dictionary.  Returns its index or -1.
+ */
+int
+lshpack_dict_lookup (const unsigned char *str, int len)
+{
+    const struct hdec_dict_el *el;
+    unsigned slot;
+
+    slot = (dict_key(str, len) * HDEC_DICT_PLAIN_SEED)
+                                                    >> (64 - HDEC_DICT_BITS);
+    if (!hdec_dict_plain_slots[slot])
+        return -1;
+    el = &hdec_dict[ hdec_dict_plain_slots[slot] - 1 ];
+    if (el->len != len || 0 != memcmp(el->str, str, len))
+        return -1;
+    return el - hdec_dict;
+}
+
+
+/* Returns the string at index `id' in the dictionary and places its length
+ * into `len'.
+ */
+const char *
+lshpack_dict_string (unsigned id, int *len)
+{
+    if (id >= HDEC_DICT_COUNT)
+        return NULL;
+    *len = hdec_dict[id].len;
+    return hdec_dict[id].str;
+}
@@ -0,0 +1,4110 @@
+/* Generated by `gen-tables digits'; do not edit. */
+
+/* hdec_digits[idx] decodes the digits at the start of the 12-bit index:
+ * `lens' is the number of bits they take shifted left by two, plus the
+ * number of digits, and `value' is their value.  If the first code is
+ * not that of a digit, `lens' is zero.
+ */
+#define HDEC_DIGITS_BITS 12
+
+struct hdec_digits { uint8_t lens, value; };
+
+static const struct hdec_digits hdec_digits[4096] =
+{
+    { 10 << 2 | 2,  0, },
+    { 10 << 2 | 2,  0, },
+    { 10 << 2 | 2,  0, },
+    { 10 << 2 | 2,  0, },
+    { 10 << 2 | 2,  1, },
+    { 10 << 2 | 2,  1, },
+    { 10 << 2 | 2,  1, },
+    { 10 << 2 | 2,  1, },
+    { 10 << 2 | 2,  2, },
+    { 10 << 2 | 2,  2, },
+    { 10 << 2 | 2,  2, },
+    { 10 << 2 | 2,  2, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    { 11 << 2 | 2,  3, },
+    { 11 << 2 | 2,  3, },
+    { 11 << 2 | 2,  4, },
+    { 11 << 2 | 2,  4, },
+    { 11 << 2 | 2,  5, },
+    { 11 << 2 | 2,  5, },
+    { 11 << 2 | 2,  6, },
+    { 11 << 2 | 2,  6, },
+    { 11 << 2 | 2,  7, },
+    { 11 << 2 | 2,  7, },
+    { 11 << 2 | 2,  8, },
+    { 11 << 2 | 2,  8, },
+    { 11 << 2 | 2,  9, },
+    { 11 << 2 | 2,  9, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    {  5 << 2 | 1,  0, },
+    { 10 << 2 | 2, 10, },
+    { 10 << 2 | 2, 10, },
+    { 10 << 2 | 2, 10, },
+    { 10 << 2 | 2, 10, },
+    { 10 << 2 | 2, 11, },
+    { 10 << 2 | 2, 11, },
+    { 10 << 2 | 2, 11, },
+    { 10 << 2 | 2, 11, },
+    { 10 << 2 | 2, 12, },
+    { 10 << 2 | 2, 12, },
+    { 10 << 2 | 2, 12, },
+    { 10 << 2 | 2, 12, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    { 11 << 2 | 2, 13, },
+    { 11 << 2 | 2, 13, },
+    { 11 << 2 | 2, 14, },
+    { 11 << 2 | 2, 14, },
+    { 11 << 2 | 2, 15, },
+    { 11 << 2 | 2, 15, },
+    { 11 << 2 | 2, 16, },
+    { 11 << 2 | 2, 16, },
+    { 11 << 2 | 2, 17, },
+    { 11 << 2 | 2, 17, },
+    { 11 << 2 | 2, 18, },
+    { 11 << 2 | 2, 18, },
+    { 11 << 2 | 2, 19, },
+    { 11 << 2 | 2, 19, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    {  5 << 2 | 1,  1, },
+    { 10 << 2 | 2, 20, },
+    { 10 << 2 | 2, 20, },
+    { 10 << 2 | 2, 20, },
+    { 10 << 2 | 2, 20, },
+    { 10 << 2 | 2, 21, },
+    { 10 << 2 | 2, 21, },
+    { 10 << 2 | 2, 21, },
+    { 10 << 2 | 2, 21, },
+    { 10 << 2 | 2, 22, },
+    { 10 << 2 | 2, 22, },
+    { 10 << 2 | 2, 22, },
+    { 10 << 2 | 2, 22, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    { 11 << 2 | 2, 23, },
+    { 11 << 2 | 2, 23, },
+    { 11 << 2 | 2, 24, },
+    { 11 << 2 | 2, 24, },
+    { 11 << 2 | 2, 25, },
+    { 11 << 2 | 2, 25, },
+    { 11 << 2 | 2, 26, },
+    { 11 << 2 | 2, 26, },
+    { 11 << 2 | 2, 27, },
+    { 11 << 2 | 2, 27, },
+    { 11 << 2 | 2, 28, },
+    { 11 << 2 | 2, 28, },
+    { 11 << 2 | 2, 29, },
+    { 11 << 2 | 2, 29, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  5 << 2 | 1,  2, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    { 11 << 2 | 2, 30, },
+    { 11 << 2 | 2, 30, },
+    { 11 << 2 | 2, 31, },
+    { 11 << 2 | 2, 31, },
+    { 11 << 2 | 2, 32, },
+    { 11 << 2 | 2, 32, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    { 12 << 2 | 2, 33, },
+    { 12 << 2 | 2, 34, },
+    { 12 << 2 | 2, 35, },
+    { 12 << 2 | 2, 36, },
+    { 12 << 2 | 2, 37, },
+    { 12 << 2 | 2, 38, },
+    { 12 << 2 | 2, 39, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    {  6 << 2 | 1,  3, },
+    { 11 << 2 | 2, 40, },
+    { 11 << 2 | 2, 40, },
+    { 11 << 2 | 2, 41, },
+    { 11 << 2 | 2, 41, },
+    { 11 << 2 | 2, 42, },
+    { 11 << 2 | 2, 42, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    { 12 << 2 | 2, 43, },
+    { 12 << 2 | 2, 44, },
+    { 12 << 2 | 2, 45, },
+    { 12 << 2 | 2, 46, },
+    { 12 << 2 | 2, 47, },
+    { 12 << 2 | 2, 48, },
+    { 12 << 2 | 2, 49, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    {  6 << 2 | 1,  4, },
+    { 11 << 2 | 2, 50, },
+    { 11 << 2 | 2, 50, },
+    { 11 << 2 | 2, 51, },
+    { 11 << 2 | 2, 51, },
+    { 11 << 2 | 2, 52, },
+    { 11 << 2 | 2, 52, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    { 12 << 2 | 2, 53, },
+    { 12 << 2 | 2, 54, },
+    { 12 << 2 | 2, 55, },
+    { 12 << 2 | 2, 56, },
+    { 12 << 2 | 2, 57, },
+    { 12 << 2 | 2, 58, },
+    { 12 << 2 | 2, 59, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    {  6 << 2 | 1,  5, },
+    { 11 << 2 | 2, 60, },
+    { 11 << 2 | 2, 60, },
+    { 11 << 2 | 2, 61, },
+    { 11 << 2 | 2, 61, },
+    { 11 << 2 | 2, 62, },
+    { 11 << 2 | 2, 62, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    { 12 << 2 | 2, 63, },
+    { 12 << 2 | 2, 64, },
+    { 12 << 2 | 2, 65, },
+    { 12 << 2 | 2, 66, },
+    { 12 << 2 | 2, 67, },
+    { 12 << 2 | 2, 68, },
+    { 12 << 2 | 2, 69, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    {  6 << 2 | 1,  6, },
+    { 11 << 2 | 2, 70, },
+    { 11 << 2 | 2, 70, },
+    { 11 << 2 | 2, 71, },
+    { 11 << 2 | 2, 71, },
+    { 11 << 2 | 2, 72, },
+    { 11 << 2 | 2, 72, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    { 12 << 2 | 2, 73, },
+    { 12 << 2 | 2, 74, },
+    { 12 << 2 | 2, 75, },
+    { 12 << 2 | 2, 76, },
+    { 12 << 2 | 2, 77, },
+    { 12 << 2 | 2, 78, },
+    { 12 << 2 | 2, 79, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    {  6 << 2 | 1,  7, },
+    { 11 << 2 | 2, 80, },
+    { 11 << 2 | 2, 80, },
+    { 11 << 2 | 2, 81, },
+    { 11 << 2 | 2, 81, },
+    { 11 << 2 | 2, 82, },
+    { 11 << 2 | 2, 82, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    { 12 << 2 | 2, 83, },
+    { 12 << 2 | 2, 84, },
+    { 12 << 2 | 2, 85, },
+    { 12 << 2 | 2, 86, },
+    { 12 << 2 | 2, 87, },
+    { 12 << 2 | 2, 88, },
+    { 12 << 2 | 2, 89, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    {  6 << 2 | 1,  8, },
+    { 11 << 2 | 2, 90, },
+    { 11 << 2 | 2, 90, },
+    { 11 << 2 | 2, 91, },
+    { 11 << 2 | 2, 91, },
+    { 11 << 2 | 2, 92, },
+    { 11 << 2 | 2, 92, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    { 12 << 2 | 2, 93, },
+    { 12 << 2 | 2, 94, },
+    { 12 << 2 | 2, 95, },
+    { 12 << 2 | 2, 96, },
+    { 12 << 2 | 2, 97, },
+    { 12 << 2 | 2, 98, },
+    { 12 << 2 | 2, 99, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  6 << 2 | 1,  9, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+    {  0 << 2 | 0,  0, },
+};
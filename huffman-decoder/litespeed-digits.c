@@ -0,0 +1,70 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "litespeed-digits-table.h"
+
+/* Powers of ten by the number of digits in a `hdec_digits' entry */
+static const uint64_t digits_pow10[3] = { 1, 10, 100, };
+
+
+/* Decode a Huffman-encoded decimal number, such as the value of
+ * content-length or :status, straight to an integer: there is no output
+ * buffer and no separate parse.  Each lookup in `hdec_digits' takes two
+ * digits -- their codes are five or six bits long.
+ *
+ * Returns the number of digits and places the number into `value'.
+ * Returns -1 if the encoding is invalid and -3 if the string is empty,
+ * holds anything but digits, or does not fit in 64 bits; in the latter
+ * case, the rest of the encoding is not checked.
+ */
+int
+lshpack_dec_huff_decode_uint (const unsigned char *src, int src_len,
+                                                            uint64_t *value)
+{
+    const unsigned char *const src_end = src + src_len;
+    uint64_t buf;           /* Left-aligned: next bit is the top bit */
+    uint64_t val;
+    unsigned avail_bits, idx;
+    struct hdec_digits el;
+    int n_digits;
+
+    buf = 0;
+    avail_bits = 0;
+    val = 0;
+    n_digits = 0;
+
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        if (avail_bits == 0)
+            break;
+        idx = buf >> (64 - HDEC_DIGITS_BITS);
+        if (avail_bits < HDEC_DIGITS_BITS)
+            idx |= (1u << (HDEC_DIGITS_BITS - avail_bits)) - 1;    /* EOF */
+        if (idx == (1u << HDEC_DIGITS_BITS) - 1 && avail_bits < 8)
+            break;                                              /* Padding */
+        el = hdec_digits[idx];
+        if (!el.lens)
+            return -3;
+        /* A digit that runs into the padding means that the padding is
+         * not all 1 bits.
+         */
+        if ((el.lens >> 2) > avail_bits)
+            return -1;
+        if (__builtin_mul_overflow(val, digits_pow10[el.lens & 3], &val)
+                        || __builtin_add_overflow(val, el.value, &val))
+            return -3;
+        n_digits += el.lens & 3;
+        buf <<= el.lens >> 2;
+        avail_bits -= el.lens >> 2;
+    }
+
+    if (!n_digits)
+        return -3;
+    *value = val;
+    return n_digits;
+}
@@ -0,0 +1,56 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "litespeed-fsm8-table.h"
+
+
+/* Full-coverage decoder like lshpack_dec_huff_decode_full(), but its FSM
+ * consumes a whole byte per step instead of a nibble.  There is a single
+ * table lookup per input byte, so the chain of dependent loads is half as
+ * long.  Each step emits at most two symbols.
+ */
+int
+lshpack_dec_huff_decode_fsm8 (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    struct hdec_fsm8 el;
+    unsigned state, nsym;
+
+    state = 0;
+    el.flags = HDEC_FSM8_ACCEPTED;
+
+    /* Fast path: don't check destination bounds */
+    while (src < src_end && dst_end - dst >= 2)
+    {
+        el = hdec_fsm8[state][*src++];
+        if (el.flags & HDEC_FSM8_FAIL)
+            return -1;
+        dst[0] = el.sym[0];
+        dst[1] = el.sym[1];
+        dst += el.flags >> HDEC_FSM8_NSYM_SHIFT;
+        state = el.state;
+    }
+
+    while (src < src_end)
+    {
+        el = hdec_fsm8[state][*src++];
+        if (el.flags & HDEC_FSM8_FAIL)
+            return -1;
+        nsym = el.flags >> HDEC_FSM8_NSYM_SHIFT;
+        if (dst + nsym > dst_end)
+            return -2;
+        if (nsym > 0)
+            *dst++ = el.sym[0];
+        if (nsym > 1)
+            *dst++ = el.sym[1];
+        state = el.state;
+    }
+
+    if (!(el.flags & HDEC_FSM8_ACCEPTED))
+        return -1;
+
+    return dst - orig_dst;
+}
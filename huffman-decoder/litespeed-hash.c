@@ -0,0 +1,162 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+
+/* The hash is the polynomial sum of b[i] * HASH_BASE^(len - 1 - i) modulo
+ * 2^32, passed through the MurmurHash3 finalizer.  The base is odd, so it
+ * has an inverse modulo 2^32.
+ */
+#define HASH_BASE 0x01000193u
+
+/* HASH_BASE to the power of 0 through 3 */
+static const uint32_t hash_pow[4] =
+{
+    0x00000001, 0x01000193, 0x26027A69, 0x3EE6B34B,
+};
+
+/* The inverse of HASH_BASE to the power of 0 through 3 */
+static const uint32_t hash_inv[4] =
+{
+    0x00000001, 0x359C449B, 0xDD4AB5D9, 0x91C5BE63,
+};
+
+
+static uint32_t
+hash_final (uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85EBCA6B;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35;
+    h ^= h >> 16;
+    return h;
+}
+
+
+/* Hash `len' bytes of plaintext.  This is what
+ * lshpack_dec_huff_decode_hash() computes as it decodes, so strings that
+ * arrive without Huffman encoding can be hashed to match.
+ */
+uint32_t
+lshpack_huff_hash (const unsigned char *buf, int len)
+{
+    uint32_t h;
+    int i;
+
+    h = 0;
+    for (i = 0; i < len; ++i)
+        h = h * HASH_BASE + buf[i];
+    return hash_final(h);
+}
+
+
+/* Add the `n' symbols of an `hdecs' entry to the hash.  The output bytes
+ * past the n-th are zero, so the polynomial of all three, taken as if the
+ * string went on with 3 - n zero bytes, is scaled back down by the inverse
+ * of the base.  The result does not depend on how the string is split
+ * into entries, and only one multiplication is on the path from one step
+ * to the next.
+ */
+static inline uint32_t
+hash_entry (uint32_t h, struct hdec hdec)
+{
+    const unsigned n = hdec.lens & 3;
+    uint32_t val;
+
+    val = ((uint32_t) hdec.out[0] * HASH_BASE + hdec.out[1]) * HASH_BASE
+                                                                + hdec.out[2];
+    return h * hash_pow[n] + val * hash_inv[3 - n];
+}
+
+
+/* lshpack_dec_huff_decode() that also places into `hash' the hash of the
+ * decoded string, the same as lshpack_huff_hash() of it.  The hash is
+ * updated as each `hdecs' entry is written, so a lookup of the string in
+ * a hash table does not have to read it back.  The decoding is that of
+ * lshpack_dec_huff_decode_class().
+ */
+int
+lshpack_dec_huff_decode_hash (const unsigned char *src, int src_len,
+                    unsigned char *dst, int dst_len, uint32_t *hash)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf, word;     /* Left-aligned: next bit is the top bit */
+    unsigned avail_bits, len, step;
+    struct hdec hdec;
+    uint16_t idx;
+    uint32_t h;
+    int r;
+
+    buf = 0;
+    avail_bits = 0;
+    h = 0;
+
+    /* Fast path: a single load refills, and there is room for three
+     * steps' worth of output.
+     */
+    while (src + sizeof(word) <= src_end && dst_end - dst >= 3 * HDEC_STEPS)
+    {
+        memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        word = bswap_64(word);
+#endif
+        buf |= word >> avail_bits;
+        src += (63 - avail_bits) >> 3;
+        avail_bits |= 56;
+        if (!hdecs[ buf >> 48 ].lens)
+        {
+            len = hdec_canon_decode(buf, avail_bits, dst);
+            if (!len)
+                return -1;
+            h = h * HASH_BASE + *dst++;
+            buf <<= len;
+            avail_bits -= len;
+            continue;
+        }
+        /* A step at a long code does nothing */
+        for (step = 0; step < HDEC_STEPS; ++step)
+        {
+            hdec = hdecs[ buf >> 48 ];
+            h = hash_entry(h, hdec);
+            dst[0] = hdec.out[0];
+            dst[1] = hdec.out[1];
+            dst[2] = hdec.out[2];
+            dst += hdec.lens & 3;
+            buf <<= hdec.lens >> 2;
+            avail_bits -= hdec.lens >> 2;
+        }
+    }
+
+    /* The last bytes of input or the last few bytes of output */
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (r == 0)
+            break;
+        if (dst_end - dst < (hdec.lens & 3))
+            return -2;
+        memcpy(dst, hdec.out, hdec.lens & 3);
+        h = hash_entry(h, hdec);
+        dst += hdec.lens & 3;
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    *hash = hash_final(h);
+    return dst - orig_dst;
+}
@@ -0,0 +1,204 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+
+#define SHORTEST_CODE 5
+#define LONGEST_CODE 30
+#define MAX_INDEX_BITS 22
+
+
+/* Multi-symbol decoders with the index width as a parameter.  Like `hdecs',
+ * a table indexed by the next `bits' bits of input gives the number of
+ * bits consumed and up to `nsym' symbols that fit into them:
+ *
+ *    bits   nsym   table size
+ *    ----   ----   ----------
+ *     12      2        12 KB
+ *     14      2        48 KB
+ *     16      3       256 KB
+ *     20      4         5 MB
+ *     22      4        20 MB
+ *
+ * An entry is one byte of (bits consumed << 3 | symbols emitted), followed
+ * by `nsym' output bytes.  Zero means that the next code is longer than
+ * `bits'.  Such codes are decoded one at a time using the canonical tables.
+ *
+ * The larger tables are too big to compile in, so the tables are built by
+ * lshpack_dec_huff_multi_init() instead.
+ */
+static uint8_t *multi_tables[MAX_INDEX_BITS + 1];
+
+
+static unsigned
+multi_nsym (unsigned bits)
+{
+    switch (bits)
+    {
+    case 12: case 14:
+        return 2;
+    case 16:
+        return 3;
+    case 20: case 22:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+
+/* Fill entries whose index begins with `prefix', `used' bits long, which
+ * decodes to the `nsym' symbols in `out'.  Longer sequences overwrite
+ * their subranges recursively.
+ */
+static void
+multi_fill (uint8_t *table, unsigned bits, unsigned max_nsym,
+            uint32_t prefix, unsigned used, unsigned nsym, uint8_t *out)
+{
+    const unsigned stride = 1 + max_nsym;
+    uint8_t *el, *const end = table + ((size_t) (prefix
+                                        + (1u << (bits - used))) * stride);
+    unsigned i, sym;
+
+    for (el = table + (size_t) prefix * stride; el < end; el += stride)
+    {
+        el[0] = used << 3 | nsym;
+        memcpy(el + 1, out, max_nsym);
+    }
+
+    /* hdec_canon_syms is sorted by code length */
+    if (nsym < max_nsym)
+        for (i = 0; i < 256
+                && used + encode_table[hdec_canon_syms[i]].bits <= bits; ++i)
+        {
+            sym = hdec_canon_syms[i];
+            out[nsym] = sym;
+            multi_fill(table, bits, max_nsym, prefix
+                        | encode_table[sym].code
+                                << (bits - used - encode_table[sym].bits),
+                        used + encode_table[sym].bits, nsym + 1, out);
+            out[nsym] = 0;
+        }
+}
+
+
+/* Build the table for index width `bits'.  Returns 0 on success and -1 if
+ * the width is not supported or memory cannot be allocated.
+ */
+int
+lshpack_dec_huff_multi_init (unsigned bits)
+{
+    const unsigned nsym = multi_nsym(bits);
+    uint8_t out[4] = { 0, 0, 0, 0, };
+    uint8_t *table;
+
+    if (!nsym)
+        return -1;
+    if (multi_tables[bits])
+        return 0;
+
+    table = malloc(((size_t) 1 << bits) * (1 + nsym));
+    if (!table)
+        return -1;
+    multi_fill(table, bits, nsym, 0, 0, 0, out);
+    multi_tables[bits] = table;
+    return 0;
+}
+
+
+/* The decoder template.  It is always inlined into the functions below,
+ * so `bits' and `nsym' are compile-time constants.
+ */
+static inline __attribute__((always_inline)) int
+hdec_multi_decode (const uint8_t *const table, const unsigned bits,
+            const unsigned nsym, const unsigned char *src, int src_len,
+            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    const uint8_t *el;
+    uint64_t buf;           /* Left-aligned: next bit is the top bit */
+    uint32_t win;
+    unsigned avail_bits, ones, len;
+
+    buf = 0;
+    avail_bits = 0;
+    while (1)
+    {
+        while (src < src_end && avail_bits <= sizeof(buf) * 8 - 8)
+        {
+            buf |= (uint64_t) *src++ << (sizeof(buf) * 8 - 8 - avail_bits);
+            avail_bits += 8;
+        }
+
+        /* Fast path: don't check destination bounds.  A buffer's worth of
+         * input produces at most this many bytes, plus `nsym' bytes may be
+         * stored past the last one.
+         */
+        if (dst_end - dst >= (ptrdiff_t) (sizeof(buf) * 8 / SHORTEST_CODE
+                                                                    + nsym))
+            while (avail_bits >= bits)
+            {
+                el = &table[ (buf >> (64 - bits)) * (1 + nsym) ];
+                if (!el[0])
+                    break;
+                memcpy(dst, el + 1, nsym);
+                dst += el[0] & 7;
+                buf <<= el[0] >> 3;
+                avail_bits -= el[0] >> 3;
+            }
+
+        if (avail_bits < LONGEST_CODE && src < src_end)
+            continue;   /* Refill */
+        if (avail_bits == 0)
+            break;
+
+        /* Slow path: a long code, the last few bits of input, or little
+         * room left in the destination.  Decode one symbol the canonical
+         * way; see litespeed-canonical.c
+         */
+        win = buf >> 32;
+        if (avail_bits < 32)
+            win |= 0xFFFFFFFFu >> avail_bits;       /* EOF */
+        ones = __builtin_clz(~win | 3);
+        if (ones >= HDEC_CANON_MAX_ONES)
+        {
+            if (avail_bits < 8)
+                break;      /* Padding */
+            return -1;      /* EOS */
+        }
+        len = hdec_canon_len0[ones]
+            + (win >= hdec_canon_lim[ones][0])
+            + (win >= hdec_canon_lim[ones][1]);
+        if (len > avail_bits)
+            return -1;      /* Code is truncated or padding is not EOS */
+        if (dst == dst_end)
+            return -2;
+        *dst++ = hdec_canon_syms[
+                        (int32_t) (win >> (32 - len)) + hdec_canon_base[len] ];
+        buf <<= len;
+        avail_bits -= len;
+    }
+
+    return dst - orig_dst;
+}
+
+
+#define MULTI_DECODER(bits, nsym)                                           \
+int                                                                         \
+lshpack_dec_huff_decode_multi##bits (const unsigned char *src, int src_len, \
+                                            unsigned char *dst, int dst_len)\
+{                                                                           \
+    return hdec_multi_decode(multi_tables[bits], bits, nsym, src, src_len,  \
+                                                            dst, dst_len);  \
+}
+
+MULTI_DECODER(12, 2)
+MULTI_DECODER(14, 2)
+MULTI_DECODER(16, 3)
+MULTI_DECODER(20, 4)
+MULTI_DECODER(22, 4)
@@ -0,0 +1,107 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+
+
+/* Top up the buffer with whole bytes, up to the end of input, using a
+ * single unaligned load.  Bits past `avail_bits' are the bytes that
+ * follow, so loading them again is harmless.
+ */
+static inline void
+padded_refill (uint64_t *buf, unsigned *avail_bits,
+            const unsigned char **src, const unsigned char *const src_end)
+{
+    uint64_t word;
+    size_t n;
+
+    memcpy(&word, *src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+    word = bswap_64(word);
+#endif
+    *buf |= word >> *avail_bits;
+    n = (63 - *avail_bits) >> 3;
+    if (n > (size_t) (src_end - *src))
+        n = src_end - *src;
+    *src += n;
+    *avail_bits += n << 3;
+}
+
+
+/* lshpack_dec_huff_decode() for input followed by at least eight readable
+ * bytes, whatever they hold.  Every refill, the last one included, is a
+ * single unaligned load: the buffer takes whole bytes up to the end of
+ * input, and the bits loaded past it are covered with 1 bits -- just
+ * like EOS padding -- whenever fewer than 16 bits are left.  There is no
+ * byte-at-a-time loop and no slow path: codes longer than 16 bits are
+ * decoded the canonical way.
+ */
+int
+lshpack_dec_huff_decode_padded (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf;           /* Left-aligned: next bit is the top bit */
+    unsigned avail_bits, len, step;
+    struct hdec hdec;
+    uint16_t idx;
+    int r;
+
+    buf = 0;
+    avail_bits = 0;
+
+    /* Fast path: a full buffer and room for three steps' worth of output */
+    while (1)
+    {
+        padded_refill(&buf, &avail_bits, &src, src_end);
+        if (avail_bits < 56 || dst_end - dst < 3 * HDEC_STEPS)
+            break;
+        if (!hdecs[ buf >> 48 ].lens)
+        {
+            len = hdec_canon_decode(buf, avail_bits, dst);
+            if (!len)
+                return -1;
+            ++dst;
+            buf <<= len;
+            avail_bits -= len;
+            continue;
+        }
+        /* A step at a long code does nothing */
+        for (step = 0; step < HDEC_STEPS; ++step)
+        {
+            hdec = hdecs[ buf >> 48 ];
+            dst[0] = hdec.out[0];
+            dst[1] = hdec.out[1];
+            dst[2] = hdec.out[2];
+            dst += hdec.lens & 3;
+            buf <<= hdec.lens >> 2;
+            avail_bits -= hdec.lens >> 2;
+        }
+    }
+
+    /* The last bits of input or the last few bytes of output */
+    while (1)
+    {
+        padded_refill(&buf, &avail_bits, &src, src_end);
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (r == 0)
+            break;
+        if (dst_end - dst < (hdec.lens & 3))
+            return -2;
+        memcpy(dst, hdec.out, hdec.lens & 3);
+        dst += hdec.lens & 3;
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    return dst - orig_dst;
+}
@@ -0,0 +1,360 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+
+int
+lshpack_dec_huff_decode_2level (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+/* Number of chunks decoded at the same time */
+#define PAR_LANES 4
+
+/* Shorter input is decoded in one piece */
+#define PAR_MIN_LEN 0x400
+
+/* Decoding from the start of chunk i must fall in step with decoding that
+ * carries on from chunk i - 1 within this many bits.  Otherwise, the
+ * whole string is decoded serially.
+ */
+#define SYNC_BITS 256
+
+/* Room between the outputs of adjacent lanes.  The decoding carried on
+ * from the previous chunk, which overwrites the start of a lane's output,
+ * may produce up to SYNC_BITS / 5 bytes more than the lane did.
+ */
+#define PAR_GAP (SYNC_BITS / 5 + 4)
+
+/* A full refill leaves at least 56 bits, enough for three lookups */
+#define PAR_STEPS 3
+
+
+struct par_lane
+{
+    const unsigned char *src, *src_lim;
+    unsigned char       *dst, *dst_start;
+    uint64_t             buf;           /* Left-aligned */
+    unsigned             avail_bits;
+    int                  failed;        /* Hit EOS */
+};
+
+
+/* Top up the buffer with a single unaligned load.  src_lim leaves room
+ * for it.
+ */
+static inline void
+par_refill (struct par_lane *lane)
+{
+    uint64_t word;
+
+    memcpy(&word, lane->src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+    word = bswap_64(word);
+#endif
+    lane->buf |= word >> lane->avail_bits;
+    lane->src += (63 - lane->avail_bits) >> 3;
+    lane->avail_bits |= 56;
+}
+
+
+/* Decode a code longer than 16 bits, which `hdecs' does not cover, the
+ * canonical way (see litespeed-canonical.c).  Called right after a refill.
+ */
+static void
+par_long_code (struct par_lane *lane)
+{
+    const uint32_t win = lane->buf >> 32;
+    const unsigned ones = __builtin_clz(~win | 3);
+    unsigned len;
+
+    if (ones >= HDEC_CANON_MAX_ONES)
+    {
+        lane->failed = 1;
+        return;
+    }
+    len = hdec_canon_len0[ones]
+        + (win >= hdec_canon_lim[ones][0])
+        + (win >= hdec_canon_lim[ones][1]);
+    *lane->dst++ = hdec_canon_syms[
+                        (int32_t) (win >> (32 - len)) + hdec_canon_base[len] ];
+    lane->buf <<= len;
+    lane->avail_bits -= len;
+}
+
+
+static void
+par_round (struct par_lane *lane)
+{
+    struct hdec hdec;
+    unsigned step;
+
+    par_refill(lane);
+    if (!hdecs[ lane->buf >> 48 ].lens)
+    {
+        par_long_code(lane);
+        return;
+    }
+    for (step = 0; step < PAR_STEPS; ++step)
+    {
+        hdec = hdecs[ lane->buf >> 48 ];
+        lane->dst[0] = hdec.out[0];
+        lane->dst[1] = hdec.out[1];
+        lane->dst[2] = hdec.out[2];
+        lane->dst += hdec.lens & 3;
+        lane->buf <<= hdec.lens >> 2;
+        lane->avail_bits -= hdec.lens >> 2;
+    }
+}
+
+
+static int
+par_running (const struct par_lane *lane)
+{
+    return !lane->failed && lane->src <= lane->src_lim;
+}
+
+
+/* Rounds for all lanes while none of them is at a long code or at the
+ * end of its chunk.  As in litespeed-batch.c, the lane state is kept in
+ * local arrays so that it stays in registers.
+ */
+static void
+par_rounds (struct par_lane *lanes)
+{
+    const unsigned char *src[PAR_LANES], *src_lim[PAR_LANES];
+    unsigned char *dst[PAR_LANES];
+    uint64_t buf[PAR_LANES], word;
+    unsigned avail_bits[PAR_LANES], l, step;
+    struct hdec hdec;
+    int go;
+
+    for (l = 0; l < PAR_LANES; ++l)
+    {
+        src[l] = lanes[l].src;
+        src_lim[l] = lanes[l].src_lim;
+        dst[l] = lanes[l].dst;
+        buf[l] = lanes[l].buf;
+        avail_bits[l] = lanes[l].avail_bits;
+    }
+
+    while (1)
+    {
+        go = 1;
+        for (l = 0; l < PAR_LANES; ++l)
+        {
+            memcpy(&word, src[l], sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+            word = bswap_64(word);
+#endif
+            buf[l] |= word >> avail_bits[l];
+            src[l] += (63 - avail_bits[l]) >> 3;
+            avail_bits[l] |= 56;
+            go &= hdecs[ buf[l] >> 48 ].lens != 0;
+        }
+        if (!go)
+            break;
+        for (step = 0; step < PAR_STEPS; ++step)
+            for (l = 0; l < PAR_LANES; ++l)
+            {
+                hdec = hdecs[ buf[l] >> 48 ];
+                dst[l][0] = hdec.out[0];
+                dst[l][1] = hdec.out[1];
+                dst[l][2] = hdec.out[2];
+                dst[l] += hdec.lens & 3;
+                buf[l] <<= hdec.lens >> 2;
+                avail_bits[l] -= hdec.lens >> 2;
+            }
+        for (l = 0; l < PAR_LANES; ++l)
+            go &= src[l] <= src_lim[l];
+        if (!go)
+            break;
+    }
+
+    for (l = 0; l < PAR_LANES; ++l)
+    {
+        lanes[l].src = src[l];
+        lanes[l].dst = dst[l];
+        lanes[l].buf = buf[l];
+        lanes[l].avail_bits = avail_bits[l];
+    }
+}
+
+
+/* Returns 32 bits of input starting at bit `pos', with 1 bits past the
+ * end of input.
+ */
+static uint32_t
+par_peek (const unsigned char *src, size_t src_len, size_t pos)
+{
+    uint64_t bits;
+    size_t i;
+
+    bits = 0;
+    for (i = pos / 8; i < pos / 8 + 5; ++i)
+        bits = bits << 8 | (i < src_len ? src[i] : 0xFF);
+    return bits >> (8 - pos % 8);
+}
+
+
+/* Decode the symbol at bit `pos' and place the length of its code into
+ * `len'.  Returns -1 at EOS or if the code runs past the end of input.
+ */
+static int
+par_symbol (const unsigned char *src, size_t src_len, size_t pos,
+                                                                unsigned *len)
+{
+    const uint32_t win = par_peek(src, src_len, pos);
+    const unsigned ones = __builtin_clz(~win | 3);
+
+    if (ones >= HDEC_CANON_MAX_ONES)
+        return -1;
+    *len = hdec_canon_len0[ones]
+         + (win >= hdec_canon_lim[ones][0])
+         + (win >= hdec_canon_lim[ones][1]);
+    if (pos + *len > src_len * 8)
+        return -1;
+    return hdec_canon_syms[
+                        (int32_t) (win >> (32 - *len)) + hdec_canon_base[*len] ];
+}
+
+
+/* Place into `points' the positions of the codes in the first SYNC_BITS
+ * bits of decoding from bit `pos'.  Returns their number.
+ */
+static unsigned
+par_sync_points (const unsigned char *src, size_t src_len, size_t pos,
+                                                            uint32_t *points)
+{
+    const size_t end = pos + SYNC_BITS;
+    unsigned n, len;
+
+    n = 0;
+    while (pos < end)
+    {
+        points[n++] = pos;
+        if (par_symbol(src, src_len, pos, &len) < 0)
+            break;
+        pos += len;
+    }
+
+    return n;
+}
+
+
+/* Huffman codes resynchronize on their own: decoding that starts at the
+ * wrong bit soon reaches a code boundary of the correct decoding, and from
+ * there on the two agree.  This decoder splits large input into PAR_LANES
+ * chunks and decodes all of them at once, each from the first bit of its
+ * chunk, interleaving the lanes as lshpack_dec_huff_decode_batch() does.
+ * Each lane writes its output to its own region of dst.
+ *
+ * Then the decoding is stitched together.  The correct decoding, carried
+ * on from the end of chunk i - 1 one code at a time, is bound to fall on
+ * a code boundary that lane i saw near the start of its chunk.  The lane's
+ * output from that code on is correct and is moved into place.
+ *
+ * dst_len must be at least src_len * 8 / 5 plus PAR_LANES * PAR_GAP for
+ * the lanes' regions.  For smaller dst, short input, or if the decoding
+ * does not fall in step, the string is decoded serially.
+ */
+int
+lshpack_dec_huff_decode_parallel (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    struct par_lane lanes[PAR_LANES];
+    uint32_t points[SYNC_BITS / 5 + 1];
+    size_t start[PAR_LANES + 1], pos;
+    unsigned char *out;
+    unsigned i, j, n, len, n_running;
+    int sym;
+
+    if (src_len < PAR_MIN_LEN
+        || dst_len < src_len * 8 / 5 + PAR_LANES * PAR_GAP)
+        return lshpack_dec_huff_decode_2level(src, src_len, dst, dst_len);
+
+    for (i = 0; i <= PAR_LANES; ++i)
+        start[i] = (size_t) src_len * i / PAR_LANES;
+    for (i = 0; i < PAR_LANES; ++i)
+    {
+        lanes[i].src = src + start[i];
+        lanes[i].src_lim = src + start[i + 1] - sizeof(uint64_t);
+        lanes[i].dst = lanes[i].dst_start
+                                    = dst + start[i] * 8 / 5 + i * PAR_GAP;
+        lanes[i].buf = 0;
+        lanes[i].avail_bits = 0;
+        lanes[i].failed = 0;
+    }
+
+    /* Decode the chunks */
+    while (1)
+    {
+        n_running = 0;
+        for (i = 0; i < PAR_LANES; ++i)
+            n_running += par_running(&lanes[i]);
+        if (n_running < PAR_LANES)
+            break;
+        par_rounds(lanes);
+        /* Get past a long code */
+        for (i = 0; i < PAR_LANES; ++i)
+            if (par_running(&lanes[i]))
+                par_round(&lanes[i]);
+    }
+    for (i = 0; i < PAR_LANES; ++i)
+    {
+        while (par_running(&lanes[i]))
+            par_round(&lanes[i]);
+        if (lanes[i].failed)
+            goto serial;
+    }
+
+    /* Stitch them together */
+    pos = (lanes[0].src - src) * 8 - lanes[0].avail_bits;
+    out = lanes[0].dst;
+    for (i = 1; i < PAR_LANES; ++i)
+    {
+        n = par_sync_points(src, src_len, start[i] * 8, points);
+        j = 0;
+        while (1)
+        {
+            while (j < n && points[j] < pos)
+                ++j;
+            if (j == n)
+                goto serial;
+            if (points[j] == pos)
+                break;
+            sym = par_symbol(src, src_len, pos, &len);
+            if (sym < 0)
+                goto serial;
+            *out++ = sym;
+            pos += len;
+        }
+        /* Lane i decoded symbol j from `pos' */
+        memmove(out, lanes[i].dst_start + j,
+                                    lanes[i].dst - lanes[i].dst_start - j);
+        out += lanes[i].dst - lanes[i].dst_start - j;
+        pos = (lanes[i].src - src) * 8 - lanes[i].avail_bits;
+    }
+
+    /* The end of the last chunk */
+    while (pos < (size_t) src_len * 8)
+    {
+        len = src_len * 8 - pos;
+        if (len < 8 && par_peek(src, src_len, pos) >> (32 - len)
+                                                        == (1u << len) - 1)
+            break;      /* Padding */
+        sym = par_symbol(src, src_len, pos, &len);
+        if (sym < 0)
+            return -1;
+        *out++ = sym;
+        pos += len;
+    }
+
+    return out - dst;
+
+  serial:
+    return lshpack_dec_huff_decode_2level(src, src_len, dst, dst_len);
+}
@@ -0,0 +1,246 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+#include "litespeed-path-table.h"
+
+
+struct path_state
+{
+    unsigned char  *seg;        /* Start of the current segment */
+    unsigned        pct;        /* Hex digits of a %XX escape still to come */
+    unsigned        byte;       /* Value of the escape so far */
+    int             query;      /* Past '?': the rest is copied as is */
+};
+
+
+static int
+hex_value (unsigned c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+
+/* The segment that starts at `seg' has just ended.  If it is ".", remove
+ * it; if it is "..", remove it along with the segment before it, as
+ * RFC 3986, Section 5.2.4, does.  Returns 1 if the segment is removed:
+ * the output then ends with the '/' that ends the segment before.
+ */
+static int
+path_dot_segment (unsigned char *const orig_dst, unsigned char **dst,
+                                                        unsigned char *seg)
+{
+    if (*dst - seg == 1 && seg[0] == '.')
+    {
+        *dst = seg;
+        return 1;
+    }
+    if (*dst - seg == 2 && seg[0] == '.' && seg[1] == '.')
+    {
+        if (seg - 1 <= orig_dst)
+            *dst = seg;         /* Nothing before it to remove */
+        else
+        {
+            *dst = seg - 1;
+            while (*dst > orig_dst && (*dst)[-1] != '/')
+                --*dst;
+            /* A relative path loses its first segment but keeps the '/' */
+            if (*dst == orig_dst)
+                *(*dst)++ = '/';
+        }
+        return 1;
+    }
+    return 0;
+}
+
+
+/* Handle one decoded symbol that is, or follows, '%', '/', or '?'.  An
+ * escape that stands for '/', '?', '%', or NUL is kept as it is, with the
+ * hex digits in uppercase, since decoding it would change the meaning of
+ * the path.  Returns 0, -2 if dst is too small, or -3 if the escape is
+ * not valid.
+ */
+static int
+path_put (struct path_state *st, unsigned char *const orig_dst,
+            unsigned char **dst, unsigned char *const dst_end, unsigned c)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    int v;
+
+    if (st->pct)
+    {
+        v = hex_value(c);
+        if (v < 0)
+            return -3;
+        st->byte = st->byte << 4 | v;
+        if (--st->pct)
+            return 0;
+        c = st->byte;
+        if (c == '/' || c == '?' || c == '%' || c == '\0')
+        {
+            if (dst_end - *dst < 3)
+                return -2;
+            (*dst)[0] = '%';
+            (*dst)[1] = hex[c >> 4];
+            (*dst)[2] = hex[c & 0xF];
+            *dst += 3;
+            return 0;
+        }
+    }
+    else if (!st->query && c == '%')
+    {
+        st->pct = 2;
+        st->byte = 0;
+        return 0;
+    }
+    else if (!st->query && c == '/')
+    {
+        if (path_dot_segment(orig_dst, dst, st->seg))
+        {
+            st->seg = *dst;
+            return 0;
+        }
+    }
+    else if (!st->query && c == '?')
+    {
+        (void) path_dot_segment(orig_dst, dst, st->seg);
+        st->query = 1;
+    }
+
+    if (*dst == dst_end)
+        return -2;
+    *(*dst)++ = c;
+    if (c == '/' && !st->query)
+        st->seg = *dst;
+    return 0;
+}
+
+
+/* Decode :path, percent-decode it, and remove dot segments from it in a
+ * single pass.  The query, from the first '?' on, is copied as is.
+ *
+ * Entries of `hdecs' that emit '%', '/', or '?' are marked in a bitmap;
+ * the symbols of those, and of any entry while a %XX escape is open, go
+ * through path_put() one at a time.  Others are stored three bytes at a
+ * time, as lshpack_dec_huff_decode() does.  Dot segments need no marks of
+ * their own: a segment is checked for "." and ".." when the '/' or '?'
+ * that ends it comes along, and it is still in dst.
+ *
+ * Returns the length of the normalized path, -1 or -2 as
+ * lshpack_dec_huff_decode() does, or -3 if a percent escape is not valid.
+ * A segment is written before it is removed, so dst may have to be a few
+ * bytes longer than the result.
+ */
+int
+lshpack_dec_huff_decode_path (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf, word;     /* Left-aligned: next bit is the top bit */
+    unsigned avail_bits, len, step, i;
+    unsigned char sym;
+    struct path_state st;
+    struct hdec hdec;
+    uint16_t idx;
+    int r, bits;
+
+    buf = 0;
+    avail_bits = 0;
+    st.seg = dst;
+    st.pct = 0;
+    st.byte = 0;
+    st.query = 0;
+
+    /* Fast path: a single load refills, and there is room for three
+     * steps' worth of output.
+     */
+    while (src + sizeof(word) <= src_end && dst_end - dst >= 3 * HDEC_STEPS)
+    {
+        memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        word = bswap_64(word);
+#endif
+        buf |= word >> avail_bits;
+        src += (63 - avail_bits) >> 3;
+        avail_bits |= 56;
+        if (!hdecs[ buf >> 48 ].lens)
+        {
+            len = hdec_canon_decode(buf, avail_bits, &sym);
+            if (!len)
+                return -1;
+            r = path_put(&st, orig_dst, &dst, dst_end, sym);
+            if (r < 0)
+                return r;
+            buf <<= len;
+            avail_bits -= len;
+            continue;
+        }
+        /* A step at a long code does nothing.  A step through path_put()
+         * may write more than three bytes -- "%2F" for the F -- so the
+         * room for the next store is checked again.
+         */
+        for (step = 0; step < HDEC_STEPS; ++step)
+        {
+            idx = buf >> 48;
+            hdec = hdecs[idx];
+            if (!st.pct && dst_end - dst >= 3 && (st.query
+                        || !(hdec_path_special[idx >> 3] >> (idx & 7) & 1)))
+            {
+                dst[0] = hdec.out[0];
+                dst[1] = hdec.out[1];
+                dst[2] = hdec.out[2];
+                dst += hdec.lens & 3;
+            }
+            else
+                for (i = 0; i < (hdec.lens & 3u); ++i)
+                {
+                    r = path_put(&st, orig_dst, &dst, dst_end, hdec.out[i]);
+                    if (r < 0)
+                        return r;
+                }
+            buf <<= hdec.lens >> 2;
+            avail_bits -= hdec.lens >> 2;
+        }
+    }
+
+    /* The last bytes of input or the last few bytes of output */
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        bits = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (bits < 0)
+            return -1;
+        if (bits == 0)
+            break;
+        for (i = 0; i < (hdec.lens & 3u); ++i)
+        {
+            r = path_put(&st, orig_dst, &dst, dst_end, hdec.out[i]);
+            if (r < 0)
+                return r;
+        }
+        buf <<= bits;
+        avail_bits -= bits;
+    }
+
+    if (st.pct)
+        return -3;
+    if (!st.query)
+        (void) path_dot_segment(orig_dst, &dst, st.seg);
+    return dst - orig_dst;
+}
@@ -0,0 +1,465 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "litespeed-table.h"
+
+int
+lshpack_dec_huff_decode (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_2level (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+typedef int (*batch_decode_f) (unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        unsigned char *const *dsts, const int *dst_lens, int *results);
+
+
+/* Used on machines without AVX2 */
+static int
+simd_decode_scalar (unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        unsigned char *const *dsts, const int *dst_lens, int *results)
+{
+    unsigned i;
+    int failed;
+
+    failed = 0;
+    for (i = 0; i < count; ++i)
+    {
+        results[i] = lshpack_dec_huff_decode(srcs[i], src_lens[i], dsts[i],
+                                                                dst_lens[i]);
+        failed |= results[i] < 0;
+    }
+
+    return failed ? -1 : 0;
+}
+
+
+#if defined(__x86_64__)
+
+#define AVX2_LANES 8
+
+/* Steps per round.  A full refill leaves at least 56 bits in each buffer,
+ * enough for three 16-bit lookups.
+ */
+#define AVX2_STEPS 3
+
+/* Each step stores four bytes, of which up to three are output */
+#define ROUND_OUT (3 * AVX2_STEPS + 1)
+
+/* Strings shorter than TAIL_MAX bytes, and the last few bytes of longer
+ * ones, are copied into the lane's `tail' and followed by 1 bits.  These
+ * must cover a code that runs past the end of invalid input, a 16-bit
+ * lookup after it, and the eight bytes of each load.  A valid string stops
+ * the lane at the 1 bits of its padding.
+ */
+#define TAIL_MAX 40
+#define TAIL_SIZE (TAIL_MAX + 24)
+
+/* Output is decoded into a lane's slot and copied to the destination when
+ * the slot is nearly full, so that the stores may overrun.
+ */
+#define OUT_SLOT 128
+
+/* Stop using vectors when fewer lanes than this have work */
+#define AVX2_MIN_LIVE 3
+
+/* Shorter strings are decoded one at a time.  Loading a lane and copying
+ * the string into its tail costs more than the lane saves on them.
+ */
+#define AVX2_MIN_LEN 24
+
+
+struct avx2_lane
+{
+    const unsigned char *in;        /* Buffer src points into */
+    const unsigned char *in_orig;   /* Position in the string of in[0] */
+    const unsigned char *end;       /* End of the string; NULL if idle */
+    unsigned char       *out, *out_start, *out_end;
+    unsigned             str;       /* Index of string in batch */
+    unsigned char        tail[TAIL_SIZE];
+    unsigned char        slot[OUT_SLOT];
+};
+
+
+/* State of the lanes.  The first four arrays are loaded into two vector
+ * registers each: lanes 0-3 and lanes 4-7.
+ */
+struct avx2_batch
+{
+    uint64_t             buf[AVX2_LANES];           /* Left-aligned */
+    uint64_t             avail_bits[AVX2_LANES];
+    const unsigned char *src[AVX2_LANES];
+    const unsigned char *src_lim[AVX2_LANES];
+    unsigned char       *dst[AVX2_LANES];           /* Into slot */
+    struct avx2_lane     lanes[AVX2_LANES];
+};
+
+
+/* Point src at the copy of the last few bytes of input */
+static void
+avx2_to_tail (struct avx2_batch *batch, unsigned l)
+{
+    struct avx2_lane *const lane = &batch->lanes[l];
+    const unsigned char *const src = lane->in_orig
+                                            + (batch->src[l] - lane->in);
+    const size_t n = lane->end - src;
+
+    memcpy(lane->tail, src, n);
+    memset(lane->tail + n, 0xFF, TAIL_SIZE - n);
+    lane->in = lane->tail;
+    lane->in_orig = src;
+    batch->src[l] = lane->tail;
+    batch->src_lim[l] = lane->tail + TAIL_SIZE - sizeof(uint64_t);
+}
+
+
+/* Return the index of the first string from `i' on that is long enough
+ * for a lane, or `count' if there is none.
+ */
+static unsigned
+avx2_next (unsigned i, unsigned count, const int *src_lens)
+{
+    while (i < count && src_lens[i] < AVX2_MIN_LEN)
+        ++i;
+    return i;
+}
+
+
+static void
+avx2_load (struct avx2_batch *batch, unsigned l, unsigned str,
+    const unsigned char *src, int src_len, unsigned char *dst, int dst_len)
+{
+    struct avx2_lane *const lane = &batch->lanes[l];
+
+    lane->in = lane->in_orig = src;
+    lane->end = src + src_len;
+    lane->out = lane->out_start = dst;
+    lane->out_end = dst + dst_len;
+    lane->str = str;
+    batch->buf[l] = 0;
+    batch->avail_bits[l] = 0;
+    batch->src[l] = src;
+    batch->dst[l] = lane->slot;
+    if (src_len >= TAIL_MAX)
+        batch->src_lim[l] = lane->end - sizeof(uint64_t);
+    else
+        avx2_to_tail(batch, l);
+}
+
+
+/* An idle lane reads nothing but 1 bits and so never moves */
+static void
+avx2_idle (struct avx2_batch *batch, unsigned l)
+{
+    struct avx2_lane *const lane = &batch->lanes[l];
+
+    memset(lane->tail, 0xFF, TAIL_SIZE);
+    lane->end = NULL;
+    batch->buf[l] = 0;
+    batch->avail_bits[l] = 0;
+    batch->src[l] = lane->tail;
+    batch->src_lim[l] = lane->tail + TAIL_SIZE - sizeof(uint64_t);
+    batch->dst[l] = lane->slot;
+}
+
+
+/* Copy the slot to the destination.  Returns -1 if it does not fit. */
+static int
+avx2_flush (struct avx2_batch *batch, unsigned l)
+{
+    struct avx2_lane *const lane = &batch->lanes[l];
+    const size_t n = batch->dst[l] - lane->slot;
+
+    if (n > (size_t) (lane->out_end - lane->out))
+        return -1;
+    memcpy(lane->out, lane->slot, n);
+    lane->out += n;
+    batch->dst[l] = lane->slot;
+    return 0;
+}
+
+
+/* The lane has reached a long code or the end of input, or its output
+ * does not fit.  Go back to the previous byte boundary, as the slow path
+ * in lshpack_dec_huff_decode() does, and finish the string with the
+ * two-level decoder.
+ */
+static int
+avx2_finish (struct avx2_batch *batch, unsigned l)
+{
+    struct avx2_lane *const lane = &batch->lanes[l];
+    const unsigned char *src;
+    uint64_t avail_bits;
+    ptrdiff_t left_bits;
+    int r;
+
+    if (0 != avx2_flush(batch, l))
+        return -2;
+
+    /* A code that runs into the 1 bits after the input means that the
+     * input does not end in EOS padding.
+     */
+    src = lane->in_orig + (batch->src[l] - lane->in);
+    avail_bits = batch->avail_bits[l];
+    left_bits = (lane->end - src) * 8 + (ptrdiff_t) avail_bits;
+    if (left_bits < 0)
+        return -1;
+
+    /* The usual case: all that is left is EOS padding */
+    if (left_bits == 0 || (left_bits < 8
+            && batch->buf[l] >> (64 - left_bits) == (1u << left_bits) - 1))
+        return lane->out - lane->out_start;
+
+    while ((avail_bits & 7) && lane->out > lane->out_start)
+        avail_bits += encode_table[ *--lane->out ].bits;
+    src -= avail_bits >> 3;
+    r = lshpack_dec_huff_decode_2level(src, lane->end - src, lane->out,
+                                                lane->out_end - lane->out);
+    if (r >= 0)
+        return lane->out - lane->out_start + r;
+    else
+        return r;
+}
+
+
+/* Returns true if the lane can go through another round */
+static int
+avx2_can_step (struct avx2_batch *batch, unsigned l)
+{
+    struct avx2_lane *const lane = &batch->lanes[l];
+
+    if (batch->dst[l] > lane->slot + OUT_SLOT - ROUND_OUT
+                                            && 0 != avx2_flush(batch, l))
+        return 0;
+    if (batch->avail_bits[l] >= 16 && !hdecs[ batch->buf[l] >> 48 ].lens)
+        return 0;
+    if (batch->src[l] > batch->src_lim[l])
+    {
+        if (lane->in == lane->tail)
+            return 0;
+        avx2_to_tail(batch, l);
+    }
+    return 1;
+}
+
+
+/* Run rounds until some lane needs attention.  A round refills all lanes
+ * with one 64-bit gather per four lanes and then takes AVX2_STEPS steps,
+ * each a 32-bit gather from `hdecs' for all eight lanes.  The outputs are
+ * stored one lane at a time, as AVX2 has no scatter.
+ */
+static __attribute__((target("avx2"))) void
+avx2_rounds (struct avx2_batch *batch)
+{
+    const __m256i bswap = _mm256_setr_epi8(
+                                7, 6, 5, 4, 3, 2, 1, 0,
+                                15, 14, 13, 12, 11, 10, 9, 8,
+                                7, 6, 5, 4, 3, 2, 1, 0,
+                                15, 14, 13, 12, 11, 10, 9, 8);
+    const __m256i c56 = _mm256_set1_epi64x(56);
+    const __m256i c63 = _mm256_set1_epi64x(63);
+    const __m256i c3f = _mm256_set1_epi64x(0x3F);
+    const __m256i cff = _mm256_set1_epi32(0xFF);
+    struct avx2_lane *const lanes = batch->lanes;
+    __m256i buf[2], avail_bits[2], src[2], src_lim[2], live, word, idx, el,
+                                                                    len[2];
+    unsigned char *dst[AVX2_LANES];
+    uint32_t els[AVX2_LANES], out, out_bytes;
+    unsigned i, l, step;
+
+    for (i = 0; i < 2; ++i)
+    {
+        buf[i] = _mm256_loadu_si256((__m256i *) &batch->buf[i * 4]);
+        avail_bits[i] = _mm256_loadu_si256(
+                                    (__m256i *) &batch->avail_bits[i * 4]);
+        src[i] = _mm256_loadu_si256((__m256i *) &batch->src[i * 4]);
+        src_lim[i] = _mm256_loadu_si256((__m256i *) &batch->src_lim[i * 4]);
+    }
+    for (l = 0; l < AVX2_LANES; ++l)
+        dst[l] = batch->dst[l];
+
+    /* 32-bit element 2i is lane i and 2i + 1 is lane i + 4 */
+    live = _mm256_setr_epi32(
+        -!!lanes[0].end, -!!lanes[4].end, -!!lanes[1].end, -!!lanes[5].end,
+        -!!lanes[2].end, -!!lanes[6].end, -!!lanes[3].end, -!!lanes[7].end);
+
+    while (1)
+    {
+        for (i = 0; i < 2; ++i)
+        {
+            word = _mm256_i64gather_epi64((const long long *) 0, src[i], 1);
+            word = _mm256_shuffle_epi8(word, bswap);
+            buf[i] = _mm256_or_si256(buf[i],
+                                    _mm256_srlv_epi64(word, avail_bits[i]));
+            src[i] = _mm256_add_epi64(src[i], _mm256_srli_epi64(
+                                _mm256_sub_epi64(c63, avail_bits[i]), 3));
+            avail_bits[i] = _mm256_or_si256(avail_bits[i], c56);
+        }
+
+        for (step = 0; step < AVX2_STEPS; ++step)
+        {
+            idx = _mm256_or_si256(_mm256_srli_epi64(buf[0], 48),
+                    _mm256_slli_epi64(_mm256_srli_epi64(buf[1], 48), 32));
+            el = _mm256_i32gather_epi32((const int *) hdecs, idx, 4);
+            /* A step at a long code does nothing.  If it is the first
+             * step, the lane has to leave.
+             */
+            if (step == 0 && _mm256_movemask_epi8(_mm256_and_si256(live,
+                        _mm256_cmpeq_epi32(_mm256_and_si256(el, cff),
+                                                _mm256_setzero_si256()))))
+                goto end;
+            _mm256_storeu_si256((__m256i *) els, el);
+            for (l = 0; l < AVX2_LANES; ++l)
+            {
+                out = els[ (l & 3) * 2 + (l >> 2) ];
+                out_bytes = out >> 8;
+                memcpy(dst[l], &out_bytes, sizeof(out_bytes));
+                dst[l] += out & 3;
+            }
+            len[0] = _mm256_and_si256(_mm256_srli_epi64(el, 2), c3f);
+            len[1] = _mm256_and_si256(_mm256_srli_epi64(el, 34), c3f);
+            for (i = 0; i < 2; ++i)
+            {
+                buf[i] = _mm256_sllv_epi64(buf[i], len[i]);
+                avail_bits[i] = _mm256_sub_epi64(avail_bits[i], len[i]);
+            }
+        }
+
+        if (_mm256_movemask_epi8(_mm256_or_si256(
+                                    _mm256_cmpgt_epi64(src[0], src_lim[0]),
+                                    _mm256_cmpgt_epi64(src[1], src_lim[1]))))
+            break;
+        for (l = 0; l < AVX2_LANES; ++l)
+            if (dst[l] > lanes[l].slot + OUT_SLOT - ROUND_OUT)
+            {
+                if (!lanes[l].end)
+                    dst[l] = lanes[l].slot;
+                else if ((size_t) (dst[l] - lanes[l].slot)
+                            <= (size_t) (lanes[l].out_end - lanes[l].out))
+                {
+                    memcpy(lanes[l].out, lanes[l].slot,
+                                                    dst[l] - lanes[l].slot);
+                    lanes[l].out += dst[l] - lanes[l].slot;
+                    dst[l] = lanes[l].slot;
+                }
+                else
+                    goto end;
+            }
+    }
+
+  end:
+    for (i = 0; i < 2; ++i)
+    {
+        _mm256_storeu_si256((__m256i *) &batch->buf[i * 4], buf[i]);
+        _mm256_storeu_si256((__m256i *) &batch->avail_bits[i * 4],
+                                                            avail_bits[i]);
+        _mm256_storeu_si256((__m256i *) &batch->src[i * 4], src[i]);
+    }
+    for (l = 0; l < AVX2_LANES; ++l)
+        batch->dst[l] = dst[l];
+}
+
+
+/* Decode a batch of strings in AVX2_LANES lanes.  A lane whose string is
+ * done is given the next one; once there are no more, it idles.  The
+ * last few strings, and strings shorter than AVX2_MIN_LEN bytes, are
+ * decoded without vectors.
+ */
+static __attribute__((target("avx2"))) int
+simd_decode_avx2 (unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        unsigned char *const *dsts, const int *dst_lens, int *results)
+{
+    struct avx2_batch batch;
+    unsigned next, n_live, l, i;
+    int failed;
+
+    failed = 0;
+    for (i = 0; i < count; ++i)
+        if (src_lens[i] < AVX2_MIN_LEN)
+        {
+            results[i] = lshpack_dec_huff_decode_2level(srcs[i], src_lens[i],
+                                                    dsts[i], dst_lens[i]);
+            failed |= results[i] < 0;
+        }
+
+    next = avx2_next(0, count, src_lens);
+    n_live = 0;
+    for (l = 0; l < AVX2_LANES; ++l)
+        if (next < count)
+        {
+            avx2_load(&batch, l, next, srcs[next], src_lens[next],
+                                            dsts[next], dst_lens[next]);
+            next = avx2_next(next + 1, count, src_lens);
+            ++n_live;
+        }
+        else
+            avx2_idle(&batch, l);
+
+    while (n_live >= AVX2_MIN_LIVE || (n_live && next < count))
+    {
+        for (l = 0; l < AVX2_LANES; ++l)
+            while (batch.lanes[l].end && !avx2_can_step(&batch, l))
+            {
+                results[batch.lanes[l].str] = avx2_finish(&batch, l);
+                failed |= results[batch.lanes[l].str] < 0;
+                if (next < count)
+                {
+                    avx2_load(&batch, l, next, srcs[next], src_lens[next],
+                                            dsts[next], dst_lens[next]);
+                    next = avx2_next(next + 1, count, src_lens);
+                }
+                else
+                {
+                    avx2_idle(&batch, l);
+                    --n_live;
+                }
+            }
+        if (n_live >= AVX2_MIN_LIVE || (n_live && next < count))
+            avx2_rounds(&batch);
+    }
+
+    for (l = 0; l < AVX2_LANES; ++l)
+        if (batch.lanes[l].end)
+        {
+            results[batch.lanes[l].str] = avx2_finish(&batch, l);
+            failed |= results[batch.lanes[l].str] < 0;
+        }
+
+    return failed ? -1 : 0;
+}
+
+#endif
+
+
+static batch_decode_f simd_decode;
+
+
+/* Decode a batch of strings using AVX2 if the CPU has it and one string
+ * at a time otherwise.  Arguments and return value are the same as those
+ * of lshpack_dec_huff_decode_batch().
+ */
+int
+lshpack_dec_huff_decode_simd (unsigned count,
+        const unsigned char *const *srcs, const int *src_lens,
+        unsigned char *const *dsts, const int *dst_lens, int *results)
+{
+    if (!simd_decode)
+    {
+#if defined(__x86_64__)
+        if (__builtin_cpu_supports("avx2"))
+            simd_decode = simd_decode_avx2;
+        else
+#endif
+            simd_decode = simd_decode_scalar;
+    }
+    return simd_decode(count, srcs, src_lens, dsts, dst_lens, results);
+}
@@ -0,0 +1,150 @@
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "litespeed-table.h"
+
+#define SHORTEST_CODE 5
+
+/* Room the caller leaves past the longest possible output */
+#define DST_SLACK 3
+
+int
+lshpack_dec_huff_decode_2level (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_decode_full (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len);
+
+
+/* lshpack_dec_huff_decode() for callers that make dst big enough for the
+ * longest possible output, one symbol per five bits of input, plus three
+ * bytes: dst_len >= src_len * 8 / 5 + 3.  Then the output cannot overrun
+ * dst and every step -- the one for the last few bits of input included --
+ * stores all three bytes of a `hdecs' entry without checking the bounds.
+ * Short strings, which lshpack_dec_huff_decode() decodes entirely in its
+ * bounds-checked loop, gain the most.
+ *
+ * If dst_len is smaller, the string is decoded by the bounds-checked
+ * lshpack_dec_huff_decode_2level() instead.
+ */
+int
+lshpack_dec_huff_decode_slack (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    uintptr_t buf;
+    unsigned avail_bits, len;
+    struct hdec hdec;
+    uint16_t idx;
+    int r;
+
+    if (dst_len < src_len * 8 / SHORTEST_CODE + DST_SLACK)
+        return lshpack_dec_huff_decode_2level(src, src_len, dst, dst_len);
+
+    buf = 0;
+    avail_bits = 0;
+    while (1)
+    {
+        if (src + sizeof(buf) <= src_end)
+        {
+            len = (sizeof(buf) * 8 - avail_bits) >> 3;
+            avail_bits += len << 3;
+            switch (len)
+            {
+#if UINTPTR_MAX == 18446744073709551615ull
+            case 8:
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+            case 7:
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+            default:
+                buf <<= 48;
+                buf |= (uintptr_t) *src++ << 40;
+                buf |= (uintptr_t) *src++ << 32;
+                buf |= (uintptr_t) *src++ << 24;
+                buf |= (uintptr_t) *src++ << 16;
+#else
+            case 4:
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+            case 3:
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+            default:
+                buf <<= 16;
+#endif
+                buf |= (uintptr_t) *src++ <<  8;
+                buf |= (uintptr_t) *src++ <<  0;
+            }
+        }
+        else if (src < src_end)
+            do
+            {
+                buf <<= 8;
+                buf |= (uintptr_t) *src++;
+                avail_bits += 8;
+            }
+            while (src < src_end && avail_bits <= sizeof(buf) * 8 - 8);
+        else
+            break;  /* Normal case terminating condition: out of input */
+
+        while (avail_bits >= 16)
+        {
+            idx = buf >> (avail_bits - 16);
+            hdec = hdecs[idx];
+            if (!hdec.lens)
+                goto slow_path;
+            dst[0] = hdec.out[0];
+            dst[1] = hdec.out[1];
+            dst[2] = hdec.out[2];
+            dst += hdec.lens & 3;
+            avail_bits -= hdec.lens >> 2;
+        }
+    }
+
+    if (avail_bits >= SHORTEST_CODE)
+    {
+        idx = buf << (16 - avail_bits);
+        idx |= (1 << (16 - avail_bits)) - 1;    /* EOF */
+        if (idx == 0xFFFF && avail_bits < 8)
+            goto end;
+        hdec = hdecs[idx];
+        /* A code longer than the bits that are left, or one that runs
+         * into the padding, means that the padding is not EOS.
+         */
+        if (!hdec.lens || (hdec.lens >> 2) > avail_bits)
+            return -1;
+        dst[0] = hdec.out[0];
+        dst[1] = hdec.out[1];
+        dst[2] = hdec.out[2];
+        dst += hdec.lens & 3;
+        avail_bits -= hdec.lens >> 2;
+    }
+
+    if (avail_bits > 0)
+    {
+        if (avail_bits >= 8
+            || ((1u << avail_bits) - 1) != (buf & ((1u << avail_bits) - 1)))
+            return -1;  /* Not EOF as expected */
+    }
+
+  end:
+    return dst - orig_dst;
+
+  slow_path:
+    /* Find previous byte boundary and finish decoding thence. */
+    while ((avail_bits & 7) && dst > orig_dst)
+        avail_bits += encode_table[ *--dst ].bits;
+    assert((avail_bits & 7) == 0);
+    src -= avail_bits >> 3;
+    r = lshpack_dec_huff_decode_full(src, src_end - src, dst,
+                                    orig_dst + dst_len - dst);
+    if (r >= 0)
+        return dst - orig_dst + r;
+    else
+        return r;
+}
@@ -0,0 +1,152 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+#include "litespeed-stream.h"
+
+/* Longest code, EOS aside.  With this many bits in the buffer, the next
+ * code is there in full, whatever comes in the next chunk.
+ */
+#define STREAM_MAX_CODE 30
+
+
+void
+lshpack_dec_huff_stream_init (struct lshpack_huff_stream *stream)
+{
+    stream->buf = 0;
+    stream->avail_bits = 0;
+}
+
+
+/* Decode the next chunk of a Huffman string, which may end anywhere, even
+ * in the middle of a code.  Codes are decoded while STREAM_MAX_CODE bits
+ * are left; the rest, fewer than four bytes' worth, is kept in the stream
+ * until the next chunk or lshpack_dec_huff_stream_finish().  Input that
+ * is split costs this much: the bits kept are read once more, and the
+ * last few bytes of each chunk are read one at a time.
+ *
+ * Returns the number of bytes written to dst, or -1 or -2 as
+ * lshpack_dec_huff_decode() does.  After an error, the stream has to be
+ * initialized again.
+ */
+int
+lshpack_dec_huff_stream_decode (struct lshpack_huff_stream *stream,
+        const unsigned char *src, int src_len, unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf, word;
+    unsigned avail_bits, len, step;
+    struct hdec hdec;
+    uint16_t idx;
+    int r;
+
+    buf = stream->buf;
+    avail_bits = stream->avail_bits;
+
+    /* Fast path: a single load refills, and there is room for three
+     * steps' worth of output.
+     */
+    while (src + sizeof(word) <= src_end && dst_end - dst >= 3 * HDEC_STEPS)
+    {
+        memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        word = bswap_64(word);
+#endif
+        buf |= word >> avail_bits;
+        src += (63 - avail_bits) >> 3;
+        avail_bits |= 56;
+        if (!hdecs[ buf >> 48 ].lens)
+        {
+            len = hdec_canon_decode(buf, avail_bits, dst);
+            if (!len)
+                return -1;
+            ++dst;
+            buf <<= len;
+            avail_bits -= len;
+            continue;
+        }
+        /* A step at a long code does nothing */
+        for (step = 0; step < HDEC_STEPS; ++step)
+        {
+            hdec = hdecs[ buf >> 48 ];
+            dst[0] = hdec.out[0];
+            dst[1] = hdec.out[1];
+            dst[2] = hdec.out[2];
+            dst += hdec.lens & 3;
+            buf <<= hdec.lens >> 2;
+            avail_bits -= hdec.lens >> 2;
+        }
+    }
+
+    /* The last bytes of the chunk or the last few bytes of output */
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        if (avail_bits < STREAM_MAX_CODE)
+            break;
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (dst_end - dst < (hdec.lens & 3))
+            return -2;
+        memcpy(dst, hdec.out, hdec.lens & 3);
+        dst += hdec.lens & 3;
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    stream->buf = buf;
+    stream->avail_bits = avail_bits;
+    return dst - orig_dst;
+}
+
+
+/* The string has ended: decode the bits kept in the stream and check the
+ * padding.  Returns the number of bytes written to dst, or -1 or -2 as
+ * lshpack_dec_huff_decode() does.
+ */
+int
+lshpack_dec_huff_stream_finish (struct lshpack_huff_stream *stream,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    unsigned char *const dst_end = dst + dst_len;
+    uint64_t buf;
+    unsigned avail_bits;
+    struct hdec hdec;
+    uint16_t idx;
+    int r;
+
+    buf = stream->buf;
+    avail_bits = stream->avail_bits;
+
+    while (1)
+    {
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (r == 0)
+            break;
+        if (dst_end - dst < (hdec.lens & 3))
+            return -2;
+        memcpy(dst, hdec.out, hdec.lens & 3);
+        dst += hdec.lens & 3;
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    stream->buf = 0;
+    stream->avail_bits = 0;
+    return dst - orig_dst;
+}
@@ -0,0 +1,28 @@
+#ifndef LITESPEED_STREAM_H
+#define LITESPEED_STREAM_H 1
+
+#include <stdint.h>
+
+/* State of a Huffman string that is decoded a chunk at a time
+ * (litespeed-stream.c).  The bits of a code that straddles two chunks
+ * stay in `buf' until the next chunk comes.
+ */
+struct lshpack_huff_stream
+{
+    uint64_t    buf;            /* Left-aligned: next bit is the top bit */
+    unsigned    avail_bits;
+};
+
+
+void
+lshpack_dec_huff_stream_init (struct lshpack_huff_stream *);
+
+int
+lshpack_dec_huff_stream_decode (struct lshpack_huff_stream *,
+        const unsigned char *src, int src_len, unsigned char *dst, int dst_len);
+
+int
+lshpack_dec_huff_stream_finish (struct lshpack_huff_stream *,
+                                            unsigned char *dst, int dst_len);
+
+#endif
@@ -0,0 +1,95 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+#include "litespeed-canonical-table.h"
+#include "litespeed-canonical.h"
+
+/* NUL is the only forbidden character with a code of 16 bits or shorter.
+ * Its 13-bit code takes up eight consecutive `hdecs' entries, whose index
+ * shifted right by three is the code.  CR and LF have 30-bit codes.
+ */
+#define NUL_CODE 0x1FF8
+#define NUL_BITS 13
+
+
+/* Check that `src' is a valid RFC 7541 Huffman string -- no EOS symbol,
+ * padding of fewer than eight 1 bits -- that does not decode to NUL, CR,
+ * or LF, without writing the decoded string anywhere.  This is what a
+ * proxy that passes encoded field values through unchanged needs to know.
+ *
+ * Returns 0 if the string is valid, -1 if the encoding is not, and -3 if
+ * the encoding is valid but the string holds a forbidden character.  In
+ * HTTP/2, the former is a connection error and the latter makes the
+ * message malformed.
+ */
+int
+lshpack_dec_huff_validate (const unsigned char *src, int src_len)
+{
+    const unsigned char *const src_end = src + src_len;
+    uint64_t buf, word;     /* Left-aligned: next bit is the top bit */
+    unsigned avail_bits, len, step, bad;
+    struct hdec hdec;
+    unsigned char sym;
+    uint16_t idx;
+    int r;
+
+    buf = 0;
+    avail_bits = 0;
+    bad = 0;
+
+    /* While eight bytes of input are left, refill with a single load */
+    while (src + sizeof(word) <= src_end)
+    {
+        memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+        word = bswap_64(word);
+#endif
+        buf |= word >> avail_bits;
+        src += (63 - avail_bits) >> 3;
+        avail_bits |= 56;
+        if (!hdecs[ buf >> 48 ].lens)
+        {
+            len = hdec_canon_decode(buf, avail_bits, &sym);
+            if (!len)
+                return -1;
+            bad |= sym == '\r' || sym == '\n';
+            buf <<= len;
+            avail_bits -= len;
+            continue;
+        }
+        /* A step at a long code does nothing */
+        for (step = 0; step < HDEC_STEPS; ++step)
+        {
+            idx = buf >> 48;
+            bad |= idx >> (16 - NUL_BITS) == NUL_CODE;
+            buf <<= hdecs[idx].lens >> 2;
+            avail_bits -= hdecs[idx].lens >> 2;
+        }
+    }
+
+    /* The last bytes of input */
+    while (1)
+    {
+        while (avail_bits <= 56 && src < src_end)
+        {
+            buf |= (uint64_t) *src++ << (56 - avail_bits);
+            avail_bits += 8;
+        }
+        r = hdec_canon_step(buf, avail_bits, &idx, &hdec);
+        if (r < 0)
+            return -1;
+        if (r == 0)
+            break;
+        /* Of NUL, CR, and LF, only the first symbol of a step can be one */
+        bad |= hdec.out[0] == '\0' || hdec.out[0] == '\r'
+                                                || hdec.out[0] == '\n';
+        buf <<= r;
+        avail_bits -= r;
+    }
+
+    return bad ? -3 : 0;
+}
@@ -0,0 +1,122 @@
+/* mk-corpus: turn a text file into a corpus of Huffman-encoded strings.
+ *
+ * Each line of the standard input is one string.  "\xHH" stands for an
+ * arbitrary byte and "\\" for a backslash.  Each string is Huffman-encoded
+ * and written to the standard output as an RFC 7541 string literal (see
+ * Section 5.2): the H bit set, the length as a 7-bit prefix integer, and
+ * then the encoded bytes.  A sequence of such literals is what a header
+ * block carries and what the corpus modes of comp-dec read.
+ *
+ * With -r, the first line is written as is, without the length, like the
+ * *.huff files that the other modes of comp-dec read.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+
+
+static size_t
+unescape (char *line)
+{
+    const char *src;
+    char *dst;
+    unsigned byte;
+
+    for (src = dst = line; *src && *src != '\n'; )
+        if (src[0] == '\\' && src[1] == 'x'
+                                    && 1 == sscanf(src + 2, "%2x", &byte))
+        {
+            *dst++ = byte;
+            src += 4;
+        }
+        else if (src[0] == '\\' && src[1] == '\\')
+        {
+            *dst++ = '\\';
+            src += 2;
+        }
+        else
+            *dst++ = *src++;
+
+    return dst - line;
+}
+
+
+static size_t
+huff_encode (const unsigned char *src, size_t len, unsigned char *dst)
+{
+    unsigned char *const orig_dst = dst;
+    uint64_t bits = 0;
+    unsigned bits_used = 0;
+    size_t i;
+
+    for (i = 0; i < len; ++i)
+    {
+        bits <<= encode_table[src[i]].bits;
+        bits |= encode_table[src[i]].code;
+        bits_used += encode_table[src[i]].bits;
+        while (bits_used >= 8)
+        {
+            bits_used -= 8;
+            *dst++ = bits >> bits_used;
+        }
+    }
+
+    if (bits_used)
+        *dst++ = (bits << (8 - bits_used)) | (0xFF >> bits_used);   /* EOS */
+
+    return dst - orig_dst;
+}
+
+
+static void
+write_literal (const unsigned char *enc, size_t len)
+{
+    size_t val;
+
+    if (len < 0x7F)
+        putchar(0x80 | len);
+    else
+    {
+        putchar(0x80 | 0x7F);
+        for (val = len - 0x7F; val >= 0x80; val >>= 7)
+            putchar(0x80 | (val & 0x7F));
+        putchar(val);
+    }
+    fwrite(enc, 1, len, stdout);
+}
+
+
+int
+main (int argc, char **argv)
+{
+    static char line[0x20000];
+    static unsigned char enc[sizeof(line) * 4];
+    size_t len;
+    int raw;
+
+    raw = argc == 2 && 0 == strcmp(argv[1], "-r");
+    if (argc != 1 && !raw)
+    {
+        fprintf(stderr, "Usage: %s [-r] <corpus.txt >corpus.hpack\n",
+                                                                    argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    while (fgets(line, sizeof(line), stdin))
+    {
+        len = unescape(line);
+        len = huff_encode((unsigned char *) line, len, enc);
+        if (raw)
+        {
+            fwrite(enc, 1, len, stdout);
+            break;
+        }
+        write_literal(enc, len);
+    }
+
+    exit(EXIT_SUCCESS);
+}
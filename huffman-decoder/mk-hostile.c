@@ -0,0 +1,280 @@
+/* mk-hostile: write corpora of Huffman strings that are costly to decode.
+ *
+ * The output is in the format of mk-corpus: a sequence of RFC 7541 string
+ * literals, which the corpus modes of comp-dec read.  The argument picks
+ * the corpus:
+ *
+ *   long       Strings of 30-bit codes only, from one to 96 of them.
+ *
+ *   mixed      Strings of 5-bit codes with a code longer than 16 bits
+ *                every second to ninth symbol.  This is what sends
+ *                lshpack_dec_huff_decode() to its slow path.  Then
+ *                strings of 5-bit codes each followed by a 12- or 13-bit
+ *                code, which do not fit into one 16-bit lookup together:
+ *                the most lookups per byte for any decoder that uses
+ *                `hdecs'.
+ *
+ *   max        Three strings of about 16 KB each: 30-bit codes, short
+ *                and long codes in turn, and random bytes.
+ *
+ *   trailer    Strings of printable text, now and then with a long code,
+ *                that end in something invalid: more than seven bits of
+ *                padding, a zero bit in the padding, EOS, or a 30-bit
+ *                code cut short.  Every one of them must be rejected, after
+ *                most of it has been decoded.
+ *
+ * The strings come from a fixed pseudo-random sequence, so the output is
+ * the same every time.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+
+/* Longest string that `max' writes, in bytes of encoding */
+#define MAX_STRING 16000
+
+struct bit_writer
+{
+    unsigned char  *dst;
+    size_t          len;
+    uint64_t        bits;
+    unsigned        bits_used;
+};
+
+/* Symbols by the length of their codes */
+static unsigned char short_syms[256], mid_syms[256], long_syms[256],
+                                                        longest_syms[256];
+static unsigned n_short, n_mid, n_long, n_longest;
+
+static uint32_t s_rand = 1;
+
+
+static unsigned
+next_rand (unsigned n)
+{
+    s_rand ^= s_rand << 13;     /* xorshift32 */
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand % n;
+}
+
+
+static void
+init_syms (void)
+{
+    unsigned sym;
+
+    for (sym = 0; sym < 256; ++sym)
+        if (encode_table[sym].bits == 5)
+            short_syms[n_short++] = sym;
+        else if (encode_table[sym].bits == 12 || encode_table[sym].bits == 13)
+            mid_syms[n_mid++] = sym;
+        else if (encode_table[sym].bits > 16)
+        {
+            long_syms[n_long++] = sym;
+            if (encode_table[sym].bits == 30)
+                longest_syms[n_longest++] = sym;
+        }
+}
+
+
+static void
+put_bits (struct bit_writer *w, uint32_t code, unsigned n)
+{
+    w->bits = (w->bits << n) | code;
+    w->bits_used += n;
+    while (w->bits_used >= 8)
+    {
+        w->bits_used -= 8;
+        w->dst[w->len++] = w->bits >> w->bits_used;
+    }
+}
+
+
+static void
+put_sym (struct bit_writer *w, unsigned sym)
+{
+    put_bits(w, encode_table[sym].code, encode_table[sym].bits);
+}
+
+
+/* Pad the string with 1 bits, as EOS does, and return its length */
+static size_t
+finish (struct bit_writer *w)
+{
+    if (w->bits_used)
+        put_bits(w, 0xFF >> w->bits_used, 8 - w->bits_used);
+    return w->len;
+}
+
+
+static void
+write_literal (const unsigned char *enc, size_t len)
+{
+    size_t val;
+
+    if (len < 0x7F)
+        putchar(0x80 | len);
+    else
+    {
+        putchar(0x80 | 0x7F);
+        for (val = len - 0x7F; val >= 0x80; val >>= 7)
+            putchar(0x80 | (val & 0x7F));
+        putchar(val);
+    }
+    fwrite(enc, 1, len, stdout);
+}
+
+
+static void
+gen_long (struct bit_writer *w)
+{
+    unsigned n, i;
+
+    for (n = 1; n <= 96; ++n)
+    {
+        w->len = 0;
+        for (i = 0; i < n; ++i)
+            put_sym(w, longest_syms[next_rand(n_longest)]);
+        write_literal(w->dst, finish(w));
+    }
+}
+
+
+static void
+gen_mixed (struct bit_writer *w)
+{
+    unsigned period, n, i;
+
+    for (period = 2; period <= 9; ++period)
+        for (n = 0; n < 8; ++n)
+        {
+            w->len = 0;
+            for (i = 0; i < 200; ++i)
+                if (i % period == period - 1)
+                    put_sym(w, long_syms[next_rand(n_long)]);
+                else
+                    put_sym(w, short_syms[next_rand(n_short)]);
+            write_literal(w->dst, finish(w));
+        }
+
+    for (n = 0; n < 16; ++n)
+    {
+        w->len = 0;
+        for (i = 0; i < 200; ++i)
+            put_sym(w, i & 1 ? mid_syms[next_rand(n_mid)]
+                                        : short_syms[next_rand(n_short)]);
+        write_literal(w->dst, finish(w));
+    }
+}
+
+
+static void
+gen_max (struct bit_writer *w)
+{
+    unsigned kind, i;
+
+    for (kind = 0; kind < 3; ++kind)
+    {
+        w->len = 0;
+        for (i = 0; w->len < MAX_STRING - 4; ++i)
+            if (kind == 0)
+                put_sym(w, longest_syms[next_rand(n_longest)]);
+            else if (kind == 1)
+                put_sym(w, i & 1 ? long_syms[next_rand(n_long)]
+                                        : short_syms[next_rand(n_short)]);
+            else
+                put_sym(w, next_rand(256));
+        write_literal(w->dst, finish(w));
+    }
+}
+
+
+static void
+gen_trailer (struct bit_writer *w)
+{
+    unsigned n, i, ones;
+
+    for (n = 0; n < 128; ++n)
+    {
+        w->len = 0;
+        for (i = 16 + next_rand(400); i > 0; --i)
+            if (next_rand(16) == 0)
+                put_sym(w, long_syms[next_rand(n_long)]);
+            else
+                put_sym(w, 32 + next_rand(95));
+        switch (n % 4)
+        {
+        case 0:
+            /* Eight or more bits of padding */
+            (void) finish(w);
+            put_bits(w, 0xFF, 8);
+            break;
+        case 1:
+            /* Padding that ends in a zero bit */
+            if (w->bits_used == 0)
+                put_sym(w, short_syms[next_rand(n_short)]);
+            put_bits(w, 0xFE & (0xFF >> w->bits_used), 8 - w->bits_used);
+            break;
+        case 2:
+            /* EOS, which may not appear in a string */
+            put_bits(w, encode_table[256].code, encode_table[256].bits);
+            (void) finish(w);
+            break;
+        default:
+            /* The first 16 to 29 bits of a 30-bit code, all 1 bits.  With
+             * any bits after them, they would be a valid code.
+             */
+            ones = 16 + next_rand(14);
+            put_bits(w, (1u << ones) - 1, ones);
+            (void) finish(w);
+            break;
+        }
+        write_literal(w->dst, w->len);
+    }
+}
+
+
+static const struct
+{
+    const char   *name;
+    void        (*gen)(struct bit_writer *);
+}
+generators[] =
+{
+    { "long", gen_long, },
+    { "mixed", gen_mixed, },
+    { "max", gen_max, },
+    { "trailer", gen_trailer, },
+};
+
+
+int
+main (int argc, char **argv)
+{
+    static unsigned char buf[MAX_STRING + 8];
+    struct bit_writer w;
+    unsigned i;
+
+    init_syms();
+    memset(&w, 0, sizeof(w));
+    w.dst = buf;
+
+    if (argc == 2)
+        for (i = 0; i < sizeof(generators) / sizeof(generators[0]); ++i)
+            if (0 == strcmp(argv[1], generators[i].name))
+            {
+                generators[i].gen(&w);
+                exit(EXIT_SUCCESS);
+            }
+
+    fprintf(stderr, "Usage: %s", argv[0]);
+    for (i = 0; i < sizeof(generators) / sizeof(generators[0]); ++i)
+        fprintf(stderr, "%s%s", i ? "|" : " ", generators[i].name);
+    fprintf(stderr, " >hostile.hpack\n");
+    exit(EXIT_FAILURE);
+}
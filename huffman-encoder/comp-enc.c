@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 int
 lshpack_enc_huff_encode_orig (const unsigned char *src, int src_len,
@@ -11,6 +12,48 @@ int
 lshpack_enc_huff_encode (const unsigned char *src,
     int len, unsigned char *dst, int dst_len);
 
+int
+lshpack_enc_huff_encode_resume (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len);
+
+void
+lshpack_enc_huff_compact_init (void);
+
+int
+lshpack_enc_huff_encode_compact (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len);
+
+void
+lshpack_enc_huff_alpha_init (void);
+
+int
+lshpack_enc_huff_encode_alpha (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len);
+
+unsigned
+lshpack_enc_huff_alphabet (const unsigned char *src, int src_len);
+
+unsigned
+lshpack_enc_huff_alphabet_scalar (const unsigned char *src, int src_len);
+
+int
+lshpack_enc_huff_encode_simd (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len);
+
+int
+lshpack_enc_huff_encode_avx2 (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len);
+
+int
+lshpack_enc_huff_encoded_len (const unsigned char *src, int src_len);
+
+int
+lshpack_enc_huff_encoded_len_scalar (const unsigned char *src, int src_len);
+
+int
+lshpack_enc_huff_encode_bounded (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len);
+
 int
 ngx_http_v2_huff_encode(const unsigned char *src, int len, unsigned char *dst,
                                                         int dst_len_UNUSED);
@@ -49,6 +92,153 @@ nghttp2_encode_wrapper (const unsigned char *src, int src_len,
 }
 
 
+/* Alphabet detection alone, without encoding */
+static int
+alphabet_wrapper (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return lshpack_enc_huff_alphabet(src, src_len);
+}
+
+
+static int
+alphabet_scalar_wrapper (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return lshpack_enc_huff_alphabet_scalar(src, src_len);
+}
+
+
+/* Length of the encoding alone, without encoding */
+static int
+len_wrapper (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return lshpack_enc_huff_encoded_len(src, src_len);
+}
+
+
+static int
+len_scalar_wrapper (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    return lshpack_enc_huff_encoded_len_scalar(src, src_len);
+}
+
+
+/* The choose modes take a value per line of the input file and write each
+ * the way an HPACK encoder does: Huffman-encoded if that is shorter and as
+ * it is otherwise.  They differ in how they find out which.
+ */
+#define MAX_VALUES 1024
+
+static const unsigned char *s_values[MAX_VALUES];
+static int s_value_lens[MAX_VALUES];
+static unsigned s_n_values;
+static int (*s_choose)(const unsigned char *, int, unsigned char *, int);
+
+
+/* Encode, then compare */
+static int
+choose_encode (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    int rv;
+
+    rv = lshpack_enc_huff_encode(src, src_len, dst, dst_len);
+    if (rv >= 0 && rv < src_len)
+        return rv;
+    memcpy(dst, src, src_len);
+    return src_len;
+}
+
+
+/* Find the length of the encoding first and encode only if it is shorter */
+static int
+choose_len (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    if (lshpack_enc_huff_encoded_len(src, src_len) < src_len)
+        return lshpack_enc_huff_encode(src, src_len, dst, dst_len);
+    memcpy(dst, src, src_len);
+    return src_len;
+}
+
+
+static int
+choose_len_scalar (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    if (lshpack_enc_huff_encoded_len_scalar(src, src_len) < src_len)
+        return lshpack_enc_huff_encode(src, src_len, dst, dst_len);
+    memcpy(dst, src, src_len);
+    return src_len;
+}
+
+
+/* Encode until the encoding cannot be shorter */
+static int
+choose_bounded (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    int rv;
+
+    rv = lshpack_enc_huff_encode_bounded(src, src_len, dst, dst_len);
+    if (rv >= 0)
+        return rv;
+    memcpy(dst, src, src_len);
+    return src_len;
+}
+
+
+static int
+choose_wrapper (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned i;
+    int total;
+
+    total = 0;
+    for (i = 0; i < s_n_values; ++i)
+        total += s_choose(s_values[i], s_value_lens[i], dst, dst_len);
+    return total;
+}
+
+
+/* Cold modes write this much memory before each call, twice the L2 of
+ * the usual server CPU, so that the tables have to come from L3 or RAM.
+ * Set it to a bit less than L2 to leave room for a small table but not
+ * for a large one.  Writing takes far longer than encoding, so the time
+ * in the encoder is measured apart.
+ */
+#ifndef EVICT_SIZE
+#define EVICT_SIZE 0x400000
+#endif
+
+static unsigned char *s_evict;
+static int (*s_cold_encode)(const unsigned char *, int, unsigned char *, int);
+static unsigned long long s_cold_ns, s_cold_calls;
+
+static int
+cold_encode_wrapper (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    struct timespec begin, end;
+    size_t off;
+    int rv;
+
+    for (off = 0; off < EVICT_SIZE; off += 64)
+        ++s_evict[off];
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    rv = s_cold_encode(src, src_len, dst, dst_len);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    s_cold_ns += (end.tv_sec - begin.tv_sec) * 1000000000ull
+                                            + end.tv_nsec - begin.tv_nsec;
+    ++s_cold_calls;
+    return rv;
+}
+
+
 int
 main (int argc, char **argv)
 {
@@ -56,15 +246,34 @@ main (int argc, char **argv)
     int count, i, rv;
     FILE *in;
     int (*encode)(const unsigned char *, int, unsigned char *, int);
-    unsigned char in_buf[0x1000];
-    unsigned char out_buf[0x4000];
+    unsigned char in_buf[0x8000];
+    unsigned char out_buf[0x20000];
 
     if (argc != 4)
     {
         fprintf(stderr,
                 "Usage: %s $file $count $mode\n"
                 "\n"
-                "  $mode is either litespeed, litespeed-orig, h2o, nghttp2, or nginx\n", argv[0]);
+                "  $mode is either litespeed, litespeed-orig, litespeed-resume,\n"
+                "    litespeed-compact, litespeed-alpha, litespeed-simd,\n"
+                "    litespeed-simd-avx2, h2o, nghttp2, or nginx\n"
+                "\n"
+                "  litespeed-cold, litespeed-resume-cold, and litespeed-compact-cold\n"
+                "    first write %uKB of other memory each time, and print the\n"
+                "    average time spent in the encoder\n"
+                "\n"
+                "  alphabet and alphabet-scalar only find the alphabet of the\n"
+                "    input for litespeed-alpha\n"
+                "\n"
+                "  litespeed-len and litespeed-len-scalar only find the\n"
+                "    length of the encoding; litespeed-bounded gives up once\n"
+                "    the encoding cannot be shorter than the input\n"
+                "\n"
+                "  litespeed-choose-encode, litespeed-choose-len,\n"
+                "    litespeed-choose-len-scalar, and litespeed-choose-bounded\n"
+                "    take a value per line and encode those that get shorter\n",
+                argv[0],
+                EVICT_SIZE >> 10);
         exit(EXIT_FAILURE);
     }
 
@@ -72,6 +281,67 @@ main (int argc, char **argv)
         encode = lshpack_enc_huff_encode;
     else if (strcasecmp(argv[3], "litespeed-orig") == 0)
         encode = lshpack_enc_huff_encode_orig;
+    else if (strcasecmp(argv[3], "litespeed-resume") == 0)
+        encode = lshpack_enc_huff_encode_resume;
+    else if (strcasecmp(argv[3], "litespeed-compact") == 0)
+    {
+        lshpack_enc_huff_compact_init();
+        encode = lshpack_enc_huff_encode_compact;
+    }
+    else if (strcasecmp(argv[3], "litespeed-alpha") == 0)
+    {
+        lshpack_enc_huff_alpha_init();
+        encode = lshpack_enc_huff_encode_alpha;
+    }
+    else if (strcasecmp(argv[3], "litespeed-simd") == 0)
+        encode = lshpack_enc_huff_encode_simd;
+    else if (strcasecmp(argv[3], "litespeed-simd-avx2") == 0)
+        encode = lshpack_enc_huff_encode_avx2;
+    else if (strcasecmp(argv[3], "litespeed-len") == 0)
+        encode = len_wrapper;
+    else if (strcasecmp(argv[3], "litespeed-len-scalar") == 0)
+        encode = len_scalar_wrapper;
+    else if (strcasecmp(argv[3], "litespeed-bounded") == 0)
+        encode = lshpack_enc_huff_encode_bounded;
+    else if (strcasecmp(argv[3], "litespeed-choose-encode") == 0)
+    {
+        s_choose = choose_encode;
+        encode = choose_wrapper;
+    }
+    else if (strcasecmp(argv[3], "litespeed-choose-len") == 0)
+    {
+        s_choose = choose_len;
+        encode = choose_wrapper;
+    }
+    else if (strcasecmp(argv[3], "litespeed-choose-len-scalar") == 0)
+    {
+        s_choose = choose_len_scalar;
+        encode = choose_wrapper;
+    }
+    else if (strcasecmp(argv[3], "litespeed-choose-bounded") == 0)
+    {
+        s_choose = choose_bounded;
+        encode = choose_wrapper;
+    }
+    else if (strcasecmp(argv[3], "alphabet") == 0)
+    {
+        lshpack_enc_huff_alpha_init();
+        encode = alphabet_wrapper;
+    }
+    else if (strcasecmp(argv[3], "alphabet-scalar") == 0)
+    {
+        lshpack_enc_huff_alpha_init();
+        encode = alphabet_scalar_wrapper;
+    }
+    else if (strcasecmp(argv[3], "litespeed-cold") == 0)
+        s_cold_encode = lshpack_enc_huff_encode;
+    else if (strcasecmp(argv[3], "litespeed-resume-cold") == 0)
+        s_cold_encode = lshpack_enc_huff_encode_resume;
+    else if (strcasecmp(argv[3], "litespeed-compact-cold") == 0)
+    {
+        lshpack_enc_huff_compact_init();
+        s_cold_encode = lshpack_enc_huff_encode_compact;
+    }
     else if (strcasecmp(argv[3], "h2o") == 0)
         encode = h2o_hpack_encode_huffman;
     else if (strcasecmp(argv[3], "nginx") == 0)
@@ -86,12 +356,40 @@ main (int argc, char **argv)
         fprintf(stderr, "Mode `%s' is invalid.  Specify either one of the following:\n"
             "  h2o\n"
             "  litespeed\n"
+            "  litespeed-resume\n"
+            "  litespeed-compact\n"
+            "  litespeed-alpha\n"
+            "  litespeed-simd\n"
+            "  litespeed-simd-avx2\n"
+            "  litespeed-len\n"
+            "  litespeed-len-scalar\n"
+            "  litespeed-bounded\n"
+            "  litespeed-choose-encode\n"
+            "  litespeed-choose-len\n"
+            "  litespeed-choose-len-scalar\n"
+            "  litespeed-choose-bounded\n"
+            "  alphabet\n"
+            "  alphabet-scalar\n"
+            "  litespeed-cold\n"
+            "  litespeed-resume-cold\n"
+            "  litespeed-compact-cold\n"
             "  nghttp2\n"
             "  nginx\n"
             , argv[3]);
         exit(EXIT_FAILURE);
     }
 
+    if (s_cold_encode)
+    {
+        s_evict = calloc(1, EVICT_SIZE);
+        if (!s_evict)
+        {
+            perror("calloc");
+            exit(EXIT_FAILURE);
+        }
+        encode = cold_encode_wrapper;
+    }
+
     in = fopen(argv[1], "rb");
     if (!in)
     {
@@ -107,6 +405,24 @@ main (int argc, char **argv)
     }
     (void) fclose(in);
 
+    if (s_choose)
+    {
+        const unsigned char *p = in_buf, *end = in_buf + in_sz, *nl;
+        while (p < end && s_n_values < MAX_VALUES)
+        {
+            nl = memchr(p, '\n', end - p);
+            if (!nl)
+                nl = end;
+            if (nl > p)
+            {
+                s_values[s_n_values] = p;
+                s_value_lens[s_n_values] = nl - p;
+                ++s_n_values;
+            }
+            p = nl + 1;
+        }
+    }
+
     count = atoi(argv[2]);
     if (!count)
         count = 1;
@@ -124,5 +440,9 @@ main (int argc, char **argv)
         (void) rv;
     }
 
+    if (s_cold_encode)
+        printf("%.1f ns per call in the encoder\n",
+                                    (double) s_cold_ns / s_cold_calls);
+
     exit(EXIT_SUCCESS);
 }
@@ -0,0 +1,359 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "litespeed-table.h"
+
+/* What lshpack_enc_huff_alphabet() returns */
+#define ALPHA_OTHER     0
+#define ALPHA_BASE64    1       /* A-Z, a-z, 0-9, `+', and `/' */
+#define ALPHA_HEX       2       /* 0-9 and a-f: digit strings, too */
+
+/* Set in `b64_idx' and `hex_idx' for bytes outside the alphabet */
+#define ALPHA_NOT       0x80
+
+/* An entry in the tables below is the code of a run of symbols shifted
+ * left by five, ORed with its length.  A length of zero means that the
+ * code does not fit into 27 bits: the run has two or more `+' in it.
+ */
+#define ALPHA_LEN_BITS  5
+#define ALPHA_MAX_CODE  (32 - ALPHA_LEN_BITS)
+
+static unsigned char b64_idx[256], hex_idx[256];
+
+/* Codes of every three base64 symbols, 64 ** 3 entries, 1 MB */
+static uint32_t b64_triples[1 << 18];
+
+/* Codes of every four hex symbols, 16 ** 4 entries, 256 KB */
+static uint32_t hex_quads[1 << 16];
+
+
+/* The first symbol of a run is in the lowest `shift' bits of its index */
+static void
+alpha_fill (uint32_t *table, const char *alphabet, unsigned shift,
+                                                                unsigned n)
+{
+    const unsigned size = 1u << (shift * n);
+    const unsigned mask = (1u << shift) - 1;
+    struct encode_el el;
+    uint64_t code;
+    unsigned i, k, bits;
+
+    for (i = 0; i < size; ++i)
+    {
+        code = 0;
+        bits = 0;
+        for (k = 0; k < n; ++k)
+        {
+            el = encode_table[ (unsigned char)
+                                    alphabet[ (i >> (shift * k)) & mask ] ];
+            code = code << el.bits | el.code;
+            bits += el.bits;
+        }
+        if (bits <= ALPHA_MAX_CODE)
+            table[i] = code << ALPHA_LEN_BITS | bits;
+        else
+            table[i] = 0;
+    }
+}
+
+
+void
+lshpack_enc_huff_alpha_init (void)
+{
+    static const char b64[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static const char hex[] = "0123456789abcdef";
+    unsigned i;
+
+    memset(b64_idx, ALPHA_NOT, sizeof(b64_idx));
+    for (i = 0; i < 64; ++i)
+        b64_idx[ (unsigned char) b64[i] ] = i;
+    memset(hex_idx, ALPHA_NOT, sizeof(hex_idx));
+    for (i = 0; i < 16; ++i)
+        hex_idx[ (unsigned char) hex[i] ] = i;
+
+    alpha_fill(b64_triples, b64, 6, 3);
+    alpha_fill(hex_quads, hex, 4, 4);
+}
+
+
+/* Up to two `=' at the end of base64 are not counted: the encoder takes
+ * them a byte at a time.
+ */
+static int
+alpha_trim (const unsigned char *src, int src_len)
+{
+    if (src_len > 0 && src[src_len - 1] == '=')
+        --src_len;
+    if (src_len > 0 && src[src_len - 1] == '=')
+        --src_len;
+    return src_len;
+}
+
+
+static unsigned
+alpha_scan (const unsigned char *src, const unsigned char *end)
+{
+    unsigned not_in;
+
+    not_in = 0;
+    while (src < end)
+    {
+        not_in |= hex_idx[*src] << 1 | b64_idx[*src];
+        if (not_in & ALPHA_NOT)
+            return ALPHA_OTHER;
+        ++src;
+    }
+
+    if (not_in & (ALPHA_NOT << 1))
+        return ALPHA_BASE64;
+    else
+        return ALPHA_HEX;
+}
+
+
+unsigned
+lshpack_enc_huff_alphabet_scalar (const unsigned char *src, int src_len)
+{
+    return alpha_scan(src, src + alpha_trim(src, src_len));
+}
+
+
+/* Find the smallest of the two alphabets that has all of the bytes of the
+ * string, if any, sixteen bytes at a time.  Bytes with the high bit set
+ * are negative and fall out of all the ranges.  Hex is a subset of base64,
+ * so the scan ends at the first byte that is not base64.
+ */
+unsigned
+lshpack_enc_huff_alphabet (const unsigned char *src, int src_len)
+{
+#ifdef __SSE2__
+    const unsigned char *const end = src + alpha_trim(src, src_len);
+    __m128i v, digit, lower, hex, b64, not_hex;
+
+    not_hex = _mm_setzero_si128();
+    while (src + 16 <= end)
+    {
+        v = _mm_loadu_si128((const __m128i *) src);
+        digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+        lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)),
+                                _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+        hex = _mm_or_si128(digit, _mm_and_si128(lower,
+                                _mm_cmplt_epi8(v, _mm_set1_epi8('f' + 1))));
+        b64 = _mm_or_si128(_mm_or_si128(digit, lower),
+            _mm_or_si128(
+                _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+                                _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1))),
+                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('+')),
+                                _mm_cmpeq_epi8(v, _mm_set1_epi8('/')))));
+        if (_mm_movemask_epi8(b64) != 0xFFFF)
+            return ALPHA_OTHER;
+        not_hex = _mm_or_si128(not_hex, _mm_andnot_si128(hex, b64));
+        src += 16;
+    }
+
+    switch (alpha_scan(src, end))
+    {
+    case ALPHA_OTHER:
+        return ALPHA_OTHER;
+    case ALPHA_HEX:
+        if (_mm_movemask_epi8(not_hex) == 0)
+            return ALPHA_HEX;
+        /* fall through */
+    default:
+        return ALPHA_BASE64;
+    }
+#else
+    return lshpack_enc_huff_alphabet_scalar(src, src_len);
+#endif
+}
+
+
+int
+lshpack_enc_huff_encode_resume (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len);
+
+
+/* Add the code of one symbol to `bits', writing the full word out first if
+ * it does not fit, as in lshpack_enc_huff_encode().  Returns -1 if there is
+ * no room for the word.
+ */
+static inline int
+alpha_put (uintptr_t *bits, unsigned *bits_used, unsigned char **p_dst,
+                        unsigned char *dst_end, struct encode_el enc_code)
+{
+    if (*bits_used + enc_code.bits < sizeof(*bits) * 8)
+    {
+        *bits <<= enc_code.bits;
+        *bits |= enc_code.code;
+        *bits_used += enc_code.bits;
+        return 0;
+    }
+    else if (*p_dst + sizeof(*bits) <= dst_end)
+    {
+        *bits <<= sizeof(*bits) * 8 - *bits_used;
+        *bits_used = enc_code.bits - (sizeof(*bits) * 8 - *bits_used);
+        *bits |= enc_code.code >> *bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+        *(*p_dst)++ = *bits >> 56;
+        *(*p_dst)++ = *bits >> 48;
+        *(*p_dst)++ = *bits >> 40;
+        *(*p_dst)++ = *bits >> 32;
+#endif
+        *(*p_dst)++ = *bits >> 24;
+        *(*p_dst)++ = *bits >> 16;
+        *(*p_dst)++ = *bits >> 8;
+        *(*p_dst)++ = *bits;
+        *bits = enc_code.code;   /* OK not to clear high bits */
+        return 0;
+    }
+    else
+        return -1;
+}
+
+
+/* Encode the string up to any `=' at the end three or four symbols per
+ * lookup, and two lookups per step, which is at most 54 bits.  The string
+ * has been checked, so there are no checks here.  Hex digits are turned
+ * into table indexes eight at a time with arithmetic; base64 takes a load
+ * from `b64_idx' per symbol.  Six base64 symbols whose codes are too long
+ * for the lookups are encoded a byte at a time.  The rest is as in
+ * lshpack_enc_huff_encode().
+ */
+static int
+alpha_encode (unsigned alphabet, const unsigned char *src, int src_len,
+                                    unsigned char *const dst, int dst_len)
+{
+    unsigned char *p_dst = dst;
+    const unsigned char *src_end = src + src_len;
+    const unsigned char *alpha_end = src + alpha_trim(src, src_len);
+    unsigned char *dst_end = p_dst + dst_len;
+    uintptr_t bits = 0;
+    unsigned bits_used = 0, adj, len, i;
+    uint64_t code, word, nib;
+    uint32_t first, second;
+
+    while (1)
+    {
+        if (alphabet == ALPHA_HEX)
+        {
+            if (!(src + 8 <= alpha_end && p_dst + sizeof(bits) <= dst_end))
+                break;
+            /* '0' to '9' are 0x30 to 0x39 and 'a' to 'f' are 0x61 to 0x66:
+             * add nine if bit 6 is set.  Then put two digits per byte, the
+             * first one low, as `hex_quads' is laid out.
+             */
+            memcpy(&word, src, sizeof(word));
+#if __BYTE_ORDER == __BIG_ENDIAN
+            word = bswap_64(word);
+#endif
+            nib = (word & 0x0F0F0F0F0F0F0F0Full)
+                                + 9 * ((word >> 6) & 0x0101010101010101ull);
+            nib = (nib | nib >> 4) & 0x00FF00FF00FF00FFull;
+            first = hex_quads[ (nib & 0xFF) | (nib >> 8 & 0xFF00) ];
+            second = hex_quads[ (nib >> 32 & 0xFF) | (nib >> 40 & 0xFF00) ];
+            src += 8;
+        }
+        else
+        {
+            if (!(src + 6 <= alpha_end && p_dst + sizeof(bits) <= dst_end))
+                break;
+            first = b64_triples[ b64_idx[src[0]]
+                            | b64_idx[src[1]] << 6 | b64_idx[src[2]] << 12 ];
+            second = b64_triples[ b64_idx[src[3]]
+                            | b64_idx[src[4]] << 6 | b64_idx[src[5]] << 12 ];
+            if (!(first && second))
+            {
+                /* Too long for an entry: these six a byte at a time */
+                for (i = 0; i < 6; ++i)
+                    if (0 != alpha_put(&bits, &bits_used, &p_dst, dst_end,
+                                                    encode_table[*src++]))
+                        return -1;
+                continue;
+            }
+            src += 6;
+        }
+        len = second & ((1u << ALPHA_LEN_BITS) - 1);
+        code = (uint64_t) (first >> ALPHA_LEN_BITS) << len
+                                                | second >> ALPHA_LEN_BITS;
+        len += first & ((1u << ALPHA_LEN_BITS) - 1);
+        if (bits_used + len < sizeof(bits) * 8)
+        {
+            bits <<= len;
+            bits |= code;
+            bits_used += len;
+            continue;
+        }
+        bits <<= sizeof(bits) * 8 - bits_used;
+        bits_used = len - (sizeof(bits) * 8 - bits_used);
+        bits |= code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+        *p_dst++ = bits >> 56;
+        *p_dst++ = bits >> 48;
+        *p_dst++ = bits >> 40;
+        *p_dst++ = bits >> 32;
+#endif
+        *p_dst++ = bits >> 24;
+        *p_dst++ = bits >> 16;
+        *p_dst++ = bits >> 8;
+        *p_dst++ = bits;
+        bits = code;   /* OK not to clear high bits */
+    }
+
+    while (src != src_end)
+        if (0 != alpha_put(&bits, &bits_used, &p_dst, dst_end,
+                                                    encode_table[*src++]))
+            return -1;
+
+    adj = bits_used + (-bits_used & 7);     /* Round up to 8 */
+    if (bits_used && p_dst + (adj >> 3) <= dst_end)
+    {
+        bits <<= -bits_used & 7;            /* Align to byte boundary */
+        bits |= ((1 << (-bits_used & 7)) - 1);  /* EOF */
+        switch (adj >> 3)
+        {                               /* Write out */
+#if UINTPTR_MAX == 18446744073709551615ull
+        case 8: *p_dst++ = bits >> 56;
+        case 7: *p_dst++ = bits >> 48;
+        case 6: *p_dst++ = bits >> 40;
+        case 5: *p_dst++ = bits >> 32;
+#endif
+        case 4: *p_dst++ = bits >> 24;
+        case 3: *p_dst++ = bits >> 16;
+        case 2: *p_dst++ = bits >> 8;
+        default: *p_dst++ = bits;
+        }
+        return p_dst - dst;
+    }
+    else if (p_dst + (adj >> 3) <= dst_end)
+        return p_dst - dst;
+    else
+        return -1;
+}
+
+
+/* Encode base64 three symbols and hex four symbols per lookup, in place of
+ * two per lookup in `hencs'.  Which table to use is found by a pass over
+ * the string first; other strings are encoded by
+ * lshpack_enc_huff_encode_resume().  lshpack_enc_huff_alpha_init() must
+ * have been called.
+ */
+int
+lshpack_enc_huff_encode_alpha (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len)
+{
+    unsigned alphabet;
+
+    alphabet = lshpack_enc_huff_alphabet(src, src_len);
+    if (alphabet != ALPHA_OTHER)
+        return alpha_encode(alphabet, src, src_len, dst, dst_len);
+    else
+        return lshpack_enc_huff_encode_resume(src, src_len, dst, dst_len);
+}
@@ -0,0 +1,197 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+
+/* Printable ASCII, 0x20 to 0x7E, and one more for all other bytes */
+#define COMPACT_N 96
+#define COMPACT_OTHER (COMPACT_N - 1)
+
+/* Index of each byte in `compact_hencs', as the second byte of a pair and
+ * as the first, times the length of a row.
+ */
+static unsigned char compact_idx[256];
+static uint16_t compact_row[256];
+
+/* `hencs' for pairs of printable bytes only: 96 * 96 entries, 72 KB rather
+ * than 512 KB.  A pair with any other byte has `lens' 64.
+ */
+static struct henc compact_hencs[COMPACT_N * COMPACT_N];
+
+
+void
+lshpack_enc_huff_compact_init (void)
+{
+    struct encode_el first, second;
+    unsigned i, j;
+
+    for (i = 0; i < 256; ++i)
+    {
+        compact_idx[i] = i >= 0x20 && i < 0x7F ? i - 0x20 : COMPACT_OTHER;
+        compact_row[i] = compact_idx[i] * COMPACT_N;
+    }
+
+    for (i = 0; i < COMPACT_N; ++i)
+        for (j = 0; j < COMPACT_N; ++j)
+        {
+            first = encode_table[0x20 + i];
+            second = encode_table[0x20 + j];
+            if (i == COMPACT_OTHER || j == COMPACT_OTHER
+                                            || first.bits + second.bits > 32)
+            {
+                compact_hencs[i * COMPACT_N + j].lens = 64;
+                compact_hencs[i * COMPACT_N + j].code = 0;
+            }
+            else
+            {
+                compact_hencs[i * COMPACT_N + j].lens
+                                                = first.bits + second.bits;
+                compact_hencs[i * COMPACT_N + j].code
+                                    = first.code << second.bits | second.code;
+            }
+        }
+}
+
+
+/* lshpack_enc_huff_encode_resume() with `compact_hencs' in place of `hencs'.
+ * Each pair costs two more loads, one from the 512-byte `compact_row' for
+ * the first byte and one from the 256-byte `compact_idx' for the second,
+ * and an addition, in exchange for a table that is seven times smaller.
+ * lshpack_enc_huff_compact_init() must have been called.
+ */
+int
+lshpack_enc_huff_encode_compact (const unsigned char *src,
+    int src_len, unsigned char *const dst, int dst_len)
+{
+    unsigned char *p_dst = dst;
+    const unsigned char *src_end = src + src_len;
+    unsigned char *dst_end = p_dst + dst_len;
+    uintptr_t bits = 0;
+    unsigned bits_used = 0, adj;
+    struct encode_el cur_enc_code;
+    const struct henc *henc;
+    unsigned i;
+
+    while (src + sizeof(bits) * 8 / 5 + 2 < src_end
+                                    && p_dst + sizeof(bits) <= dst_end)
+    {
+        henc = &compact_hencs[ compact_row[src[0]] + compact_idx[src[1]] ];
+        src += 2;
+        while (bits_used + henc->lens < sizeof(bits) * 8)
+        {
+            bits <<= henc->lens;
+            bits |= henc->code;
+            bits_used += henc->lens;
+            henc = &compact_hencs[ compact_row[src[0]] + compact_idx[src[1]] ];
+            src += 2;
+        }
+        if (henc->lens < 64)
+        {
+            bits <<= sizeof(bits) * 8 - bits_used;
+            bits_used = henc->lens - (sizeof(bits) * 8 - bits_used);
+            bits |= henc->code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+            *p_dst++ = bits >> 56;
+            *p_dst++ = bits >> 48;
+            *p_dst++ = bits >> 40;
+            *p_dst++ = bits >> 32;
+#endif
+            *p_dst++ = bits >> 24;
+            *p_dst++ = bits >> 16;
+            *p_dst++ = bits >> 8;
+            *p_dst++ = bits;
+            bits = henc->code;   /* OK not to clear high bits */
+        }
+        else
+        {
+            /* The pair has a byte that is not printable, or its codes do
+             * not fit into 32 bits together: encode its two bytes one at a
+             * time and go back to pairs.
+             * Nothing has been written out since the check for room
+             * above, and only one of the two codes can fill `bits'.
+             */
+            src -= 2;
+            for (i = 0; i < 2; ++i)
+            {
+                cur_enc_code = encode_table[*src++];
+                if (bits_used + cur_enc_code.bits < sizeof(bits) * 8)
+                {
+                    bits <<= cur_enc_code.bits;
+                    bits |= cur_enc_code.code;
+                    bits_used += cur_enc_code.bits;
+                    continue;
+                }
+                bits <<= sizeof(bits) * 8 - bits_used;
+                bits_used = cur_enc_code.bits - (sizeof(bits) * 8 - bits_used);
+                bits |= cur_enc_code.code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+                *p_dst++ = bits >> 56;
+                *p_dst++ = bits >> 48;
+                *p_dst++ = bits >> 40;
+                *p_dst++ = bits >> 32;
+#endif
+                *p_dst++ = bits >> 24;
+                *p_dst++ = bits >> 16;
+                *p_dst++ = bits >> 8;
+                *p_dst++ = bits;
+                bits = cur_enc_code.code;   /* OK not to clear high bits */
+            }
+        }
+    }
+
+    while (src != src_end)
+    {
+        cur_enc_code = encode_table[*src++];
+        if (bits_used + cur_enc_code.bits < sizeof(bits) * 8)
+        {
+            bits <<= cur_enc_code.bits;
+            bits |= cur_enc_code.code;
+            bits_used += cur_enc_code.bits;
+            continue;
+        }
+        else if (p_dst + sizeof(bits) <= dst_end)
+        {
+            bits <<= sizeof(bits) * 8 - bits_used;
+            bits_used = cur_enc_code.bits - (sizeof(bits) * 8 - bits_used);
+            bits |= cur_enc_code.code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+            *p_dst++ = bits >> 56;
+            *p_dst++ = bits >> 48;
+            *p_dst++ = bits >> 40;
+            *p_dst++ = bits >> 32;
+#endif
+            *p_dst++ = bits >> 24;
+            *p_dst++ = bits >> 16;
+            *p_dst++ = bits >> 8;
+            *p_dst++ = bits;
+            bits = cur_enc_code.code;   /* OK not to clear high bits */
+        }
+        else
+            return -1;
+    }
+
+    adj = bits_used + (-bits_used & 7);     /* Round up to 8 */
+    if (bits_used && p_dst + (adj >> 3) <= dst_end)
+    {
+        bits <<= -bits_used & 7;            /* Align to byte boundary */
+        bits |= ((1 << (-bits_used & 7)) - 1);  /* EOF */
+        switch (adj >> 3)
+        {                               /* Write out */
+#if UINTPTR_MAX == 18446744073709551615ull
+        case 8: *p_dst++ = bits >> 56;
+        case 7: *p_dst++ = bits >> 48;
+        case 6: *p_dst++ = bits >> 40;
+        case 5: *p_dst++ = bits >> 32;
+#endif
+        case 4: *p_dst++ = bits >> 24;
+        case 3: *p_dst++ = bits >> 16;
+        case 2: *p_dst++ = bits >> 8;
+        default: *p_dst++ = bits;
+        }
+        return p_dst - dst;
+    }
+    else if (p_dst + (adj >> 3) <= dst_end)
+        return p_dst - dst;
+    else
+        return -1;
+}
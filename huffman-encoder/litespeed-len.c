@@ -0,0 +1,298 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "litespeed-table.h"
+
+/* No code is shorter than this */
+#define MIN_CODE_LEN 5
+
+
+/* Return the length of the Huffman encoding of `src' in bytes, padding
+ * included, without encoding it.  HPACK and QPACK encoders use Huffman
+ * only if it is shorter than the string itself.
+ */
+int
+lshpack_enc_huff_encoded_len_scalar (const unsigned char *src, int src_len)
+{
+    const unsigned char *const src_end = src + src_len;
+    unsigned bits0, bits1, bits2, bits3;
+
+    bits0 = bits1 = bits2 = bits3 = 0;
+    for (; src + 4 <= src_end; src += 4)
+    {
+        bits0 += encode_table[src[0]].bits;
+        bits1 += encode_table[src[1]].bits;
+        bits2 += encode_table[src[2]].bits;
+        bits3 += encode_table[src[3]].bits;
+    }
+    while (src < src_end)
+        bits0 += encode_table[*src++].bits;
+
+    return (bits0 + bits1 + bits2 + bits3 + 7) >> 3;
+}
+
+
+#if defined(__x86_64__)
+
+/* Code lengths of all bytes, for vpermi2b */
+static unsigned char len_lens[256];
+
+
+static void
+len_init_tables (void)
+{
+    unsigned i;
+
+    for (i = 0; i < 256; ++i)
+        len_lens[i] = encode_table[i].bits;
+}
+
+
+/* Look up the lengths of 64 bytes at a time in two 128-byte tables, one
+ * for ASCII and one for the rest, and add them up eight at a time with
+ * vpsadbw.  The bytes past the end of the string are given a length of
+ * zero.
+ */
+static __attribute__((target("avx512f,avx512bw,avx512vbmi"))) int
+len_avx512 (const unsigned char *src, int src_len)
+{
+    const unsigned char *const src_end = src + src_len;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i ascii_lo = _mm512_loadu_si512(len_lens);
+    const __m512i ascii_hi = _mm512_loadu_si512(len_lens + 64);
+    const __m512i other_lo = _mm512_loadu_si512(len_lens + 128);
+    const __m512i other_hi = _mm512_loadu_si512(len_lens + 192);
+    __m512i in, lens, sums;
+    __mmask64 live;
+
+    sums = zero;
+    for (; src < src_end; src += 64)
+    {
+        if (src_end - src >= 64)
+        {
+            live = ~0ull;
+            in = _mm512_loadu_si512(src);
+        }
+        else
+        {
+            live = ~0ull >> (64 - (src_end - src));
+            in = _mm512_maskz_loadu_epi8(live, src);
+        }
+        lens = _mm512_mask_blend_epi8(_mm512_movepi8_mask(in),
+                        _mm512_permutex2var_epi8(ascii_lo, in, ascii_hi),
+                        _mm512_permutex2var_epi8(other_lo, in, other_hi));
+        lens = _mm512_maskz_mov_epi8(live, lens);
+        sums = _mm512_add_epi64(sums, _mm512_sad_epu8(lens, zero));
+    }
+
+    return (_mm512_reduce_add_epi64(sums) + 7) >> 3;
+}
+
+#endif
+
+
+static int (*len_func) (const unsigned char *, int);
+
+
+/* lshpack_enc_huff_encoded_len_scalar() using AVX-512 if the CPU has it */
+int
+lshpack_enc_huff_encoded_len (const unsigned char *src, int src_len)
+{
+    if (!len_func)
+    {
+#if defined(__x86_64__)
+        if (__builtin_cpu_supports("avx512f")
+                && __builtin_cpu_supports("avx512bw")
+                && __builtin_cpu_supports("avx512vbmi"))
+        {
+            len_init_tables();
+            len_func = len_avx512;
+        }
+        else
+#endif
+            len_func = lshpack_enc_huff_encoded_len_scalar;
+    }
+    return len_func(src, src_len);
+}
+
+
+/* Whether the output can no longer fit into `max_bits': `written' bytes
+ * and `bits_used' bits of it are there, and each of the `left' bytes of
+ * input adds at least MIN_CODE_LEN bits.
+ */
+static inline int
+bounded_over (size_t written, unsigned bits_used, size_t left,
+                                                            size_t max_bits)
+{
+    return written * 8 + bits_used + left * MIN_CODE_LEN > max_bits;
+}
+
+
+/* lshpack_enc_huff_encode_resume() for an encoder that sends the string
+ * as it is unless Huffman makes it shorter.  Returns -1 if the encoding is
+ * not shorter than `src_len' or does not fit into `dst_len'; the caller
+ * then writes the string itself.
+ *
+ * This gives up as soon as the bits written and MIN_CODE_LEN bits for each
+ * byte left add up to more than fits: for a string of bytes with long
+ * codes, not long after it begins.  The check is made once per 64 bits of
+ * output.
+ */
+int
+lshpack_enc_huff_encode_bounded (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len)
+{
+    unsigned char *p_dst = dst;
+    const unsigned char *src_end = src + src_len;
+    unsigned char *dst_end;
+    uintptr_t bits = 0;
+    unsigned bits_used = 0, adj;
+    struct encode_el cur_enc_code;
+    const struct henc *henc;
+    uint16_t idx;
+    unsigned i;
+    size_t max_bits;
+
+    if (dst_len > src_len - 1)
+        dst_len = src_len - 1;
+    if (dst_len <= 0)
+        return -1;
+    dst_end = dst + dst_len;
+    max_bits = (size_t) dst_len * 8;
+    if ((size_t) src_len * MIN_CODE_LEN > max_bits)
+        return -1;
+
+    while (src + sizeof(bits) * 8 / 5 + sizeof(idx) < src_end
+                                    && p_dst + sizeof(bits) <= dst_end)
+    {
+        memcpy(&idx, src, 2);
+        henc = &hencs[idx];
+        src += 2;
+        while (bits_used + henc->lens < sizeof(bits) * 8)
+        {
+            bits <<= henc->lens;
+            bits |= henc->code;
+            bits_used += henc->lens;
+            memcpy(&idx, src, 2);
+            henc = &hencs[idx];
+            src += 2;
+        }
+        if (henc->lens < 64)
+        {
+            bits <<= sizeof(bits) * 8 - bits_used;
+            bits_used = henc->lens - (sizeof(bits) * 8 - bits_used);
+            bits |= henc->code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+            *p_dst++ = bits >> 56;
+            *p_dst++ = bits >> 48;
+            *p_dst++ = bits >> 40;
+            *p_dst++ = bits >> 32;
+#endif
+            *p_dst++ = bits >> 24;
+            *p_dst++ = bits >> 16;
+            *p_dst++ = bits >> 8;
+            *p_dst++ = bits;
+            bits = henc->code;   /* OK not to clear high bits */
+            if (bounded_over(p_dst - dst, bits_used, src_end - src, max_bits))
+                return -1;
+        }
+        else
+        {
+            /* As in lshpack_enc_huff_encode_resume(): the two bytes one
+             * at a time, then back to pairs.
+             */
+            src -= 2;
+            for (i = 0; i < 2; ++i)
+            {
+                cur_enc_code = encode_table[*src++];
+                if (bits_used + cur_enc_code.bits < sizeof(bits) * 8)
+                {
+                    bits <<= cur_enc_code.bits;
+                    bits |= cur_enc_code.code;
+                    bits_used += cur_enc_code.bits;
+                    continue;
+                }
+                bits <<= sizeof(bits) * 8 - bits_used;
+                bits_used = cur_enc_code.bits - (sizeof(bits) * 8 - bits_used);
+                bits |= cur_enc_code.code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+                *p_dst++ = bits >> 56;
+                *p_dst++ = bits >> 48;
+                *p_dst++ = bits >> 40;
+                *p_dst++ = bits >> 32;
+#endif
+                *p_dst++ = bits >> 24;
+                *p_dst++ = bits >> 16;
+                *p_dst++ = bits >> 8;
+                *p_dst++ = bits;
+                bits = cur_enc_code.code;   /* OK not to clear high bits */
+                if (bounded_over(p_dst - dst, bits_used, src_end - src,
+                                                                max_bits))
+                    return -1;
+            }
+        }
+    }
+
+    while (src != src_end)
+    {
+        cur_enc_code = encode_table[*src++];
+        if (bits_used + cur_enc_code.bits < sizeof(bits) * 8)
+        {
+            bits <<= cur_enc_code.bits;
+            bits |= cur_enc_code.code;
+            bits_used += cur_enc_code.bits;
+            continue;
+        }
+        else if (p_dst + sizeof(bits) <= dst_end)
+        {
+            bits <<= sizeof(bits) * 8 - bits_used;
+            bits_used = cur_enc_code.bits - (sizeof(bits) * 8 - bits_used);
+            bits |= cur_enc_code.code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+            *p_dst++ = bits >> 56;
+            *p_dst++ = bits >> 48;
+            *p_dst++ = bits >> 40;
+            *p_dst++ = bits >> 32;
+#endif
+            *p_dst++ = bits >> 24;
+            *p_dst++ = bits >> 16;
+            *p_dst++ = bits >> 8;
+            *p_dst++ = bits;
+            bits = cur_enc_code.code;   /* OK not to clear high bits */
+            if (bounded_over(p_dst - dst, bits_used, src_end - src, max_bits))
+                return -1;
+        }
+        else
+            return -1;
+    }
+
+    adj = bits_used + (-bits_used & 7);     /* Round up to 8 */
+    if (bits_used && p_dst + (adj >> 3) <= dst_end)
+    {
+        bits <<= -bits_used & 7;            /* Align to byte boundary */
+        bits |= ((1 << (-bits_used & 7)) - 1);  /* EOF */
+        switch (adj >> 3)
+        {                               /* Write out */
+#if UINTPTR_MAX == 18446744073709551615ull
+        case 8: *p_dst++ = bits >> 56;
+        case 7: *p_dst++ = bits >> 48;
+        case 6: *p_dst++ = bits >> 40;
+        case 5: *p_dst++ = bits >> 32;
+#endif
+        case 4: *p_dst++ = bits >> 24;
+        case 3: *p_dst++ = bits >> 16;
+        case 2: *p_dst++ = bits >> 8;
+        default: *p_dst++ = bits;
+        }
+        return p_dst - dst;
+    }
+    else if (p_dst + (adj >> 3) <= dst_end)
+        return p_dst - dst;
+    else
+        return -1;
+}
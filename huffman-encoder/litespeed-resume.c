@@ -0,0 +1,151 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "litespeed-table.h"
+
+
+/* Same as lshpack_enc_huff_encode(), except for what happens at a pair of
+ * bytes whose entry in `hencs' is not there (`lens' is 64): one of them has
+ * a long code, such as a backslash or a byte that is not ASCII.  Instead
+ * of encoding the rest of the string a byte at a time, encode that pair so
+ * and stay in the pair loop.  One odd byte early in a long value thus no
+ * longer slows down everything after it.
+ */
+int
+lshpack_enc_huff_encode_resume (const unsigned char *src,
+    int src_len, unsigned char *const dst, int dst_len)
+{
+    unsigned char *p_dst = dst;
+    const unsigned char *src_end = src + src_len;
+    unsigned char *dst_end = p_dst + dst_len;
+    uintptr_t bits = 0;
+    unsigned bits_used = 0, adj;
+    struct encode_el cur_enc_code;
+    const struct henc *henc;
+    uint16_t idx;
+    unsigned i;
+
+    while (src + sizeof(bits) * 8 / 5 + sizeof(idx) < src_end
+                                    && p_dst + sizeof(bits) <= dst_end)
+    {
+        memcpy(&idx, src, 2);
+        henc = &hencs[idx];
+        src += 2;
+        while (bits_used + henc->lens < sizeof(bits) * 8)
+        {
+            bits <<= henc->lens;
+            bits |= henc->code;
+            bits_used += henc->lens;
+            memcpy(&idx, src, 2);
+            henc = &hencs[idx];
+            src += 2;
+        }
+        if (henc->lens < 64)
+        {
+            bits <<= sizeof(bits) * 8 - bits_used;
+            bits_used = henc->lens - (sizeof(bits) * 8 - bits_used);
+            bits |= henc->code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+            *p_dst++ = bits >> 56;
+            *p_dst++ = bits >> 48;
+            *p_dst++ = bits >> 40;
+            *p_dst++ = bits >> 32;
+#endif
+            *p_dst++ = bits >> 24;
+            *p_dst++ = bits >> 16;
+            *p_dst++ = bits >> 8;
+            *p_dst++ = bits;
+            bits = henc->code;   /* OK not to clear high bits */
+        }
+        else
+        {
+            /* The codes of the pair do not fit into 32 bits together:
+             * encode its two bytes one at a time and go back to pairs.
+             * Nothing has been written out since the check for room
+             * above, and only one of the two codes can fill `bits'.
+             */
+            src -= 2;
+            for (i = 0; i < 2; ++i)
+            {
+                cur_enc_code = encode_table[*src++];
+                if (bits_used + cur_enc_code.bits < sizeof(bits) * 8)
+                {
+                    bits <<= cur_enc_code.bits;
+                    bits |= cur_enc_code.code;
+                    bits_used += cur_enc_code.bits;
+                    continue;
+                }
+                bits <<= sizeof(bits) * 8 - bits_used;
+                bits_used = cur_enc_code.bits - (sizeof(bits) * 8 - bits_used);
+                bits |= cur_enc_code.code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+                *p_dst++ = bits >> 56;
+                *p_dst++ = bits >> 48;
+                *p_dst++ = bits >> 40;
+                *p_dst++ = bits >> 32;
+#endif
+                *p_dst++ = bits >> 24;
+                *p_dst++ = bits >> 16;
+                *p_dst++ = bits >> 8;
+                *p_dst++ = bits;
+                bits = cur_enc_code.code;   /* OK not to clear high bits */
+            }
+        }
+    }
+
+    while (src != src_end)
+    {
+        cur_enc_code = encode_table[*src++];
+        if (bits_used + cur_enc_code.bits < sizeof(bits) * 8)
+        {
+            bits <<= cur_enc_code.bits;
+            bits |= cur_enc_code.code;
+            bits_used += cur_enc_code.bits;
+            continue;
+        }
+        else if (p_dst + sizeof(bits) <= dst_end)
+        {
+            bits <<= sizeof(bits) * 8 - bits_used;
+            bits_used = cur_enc_code.bits - (sizeof(bits) * 8 - bits_used);
+            bits |= cur_enc_code.code >> bits_used;
+#if UINTPTR_MAX == 18446744073709551615ull
+            *p_dst++ = bits >> 56;
+            *p_dst++ = bits >> 48;
+            *p_dst++ = bits >> 40;
+            *p_dst++ = bits >> 32;
+#endif
+            *p_dst++ = bits >> 24;
+            *p_dst++ = bits >> 16;
+            *p_dst++ = bits >> 8;
+            *p_dst++ = bits;
+            bits = cur_enc_code.code;   /* OK not to clear high bits */
+        }
+        else
+            return -1;
+    }
+
+    adj = bits_used + (-bits_used & 7);     /* Round up to 8 */
+    if (bits_used && p_dst + (adj >> 3) <= dst_end)
+    {
+        bits <<= -bits_used & 7;            /* Align to byte boundary */
+        bits |= ((1 << (-bits_used & 7)) - 1);  /* EOF */
+        switch (adj >> 3)
+        {                               /* Write out */
+#if UINTPTR_MAX == 18446744073709551615ull
+        case 8: *p_dst++ = bits >> 56;
+        case 7: *p_dst++ = bits >> 48;
+        case 6: *p_dst++ = bits >> 40;
+        case 5: *p_dst++ = bits >> 32;
+#endif
+        case 4: *p_dst++ = bits >> 24;
+        case 3: *p_dst++ = bits >> 16;
+        case 2: *p_dst++ = bits >> 8;
+        default: *p_dst++ = bits;
+        }
+        return p_dst - dst;
+    }
+    else if (p_dst + (adj >> 3) <= dst_end)
+        return p_dst - dst;
+    else
+        return -1;
+}
@@ -0,0 +1,569 @@
+#include <byteswap.h>
+#include <endian.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "litespeed-table.h"
+
+int
+lshpack_enc_huff_encode (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len);
+
+typedef int (*encode_f) (const unsigned char *, int, unsigned char *, int);
+
+/* Bytes of input per block of the AVX-512 loop; the AVX2 loop takes half
+ * as many.
+ */
+#define SIMD_BLOCK 64
+
+/* Shorter strings are left to lshpack_enc_huff_encode(): the vector loops
+ * do not pay for themselves until there is a whole AVX-512 block.
+ */
+#define SIMD_MIN_LEN SIMD_BLOCK
+
+/* The vector loops run while there is this much room: a block that they
+ * cannot take may take 64 * 30 bits.
+ */
+#define SIMD_MIN_ROOM (SIMD_BLOCK * 30 / 8 + 8)
+
+
+/* Output is kept left-aligned in `acc', `used' bits of it, fewer than 64.
+ * Write out a word when it is full, if there is room for it.
+ */
+static inline int
+simd_put (uint64_t *acc, unsigned *used, unsigned char **p_dst,
+            unsigned char *dst_end, uint32_t code, unsigned len)
+{
+    uint64_t word;
+    unsigned end;
+
+    end = *used + len;
+    if (end < 64)
+    {
+        *acc |= (uint64_t) code << (64 - end);
+        *used = end;
+        return 0;
+    }
+    if (dst_end - *p_dst < (int) sizeof(word))
+        return -1;
+    word = *acc | code >> (end - 64);
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+    word = bswap_64(word);
+#endif
+    memcpy(*p_dst, &word, sizeof(word));
+    *p_dst += sizeof(word);
+    *acc = end > 64 ? (uint64_t) code << (128 - end) : 0;
+    *used = end - 64;
+    return 0;
+}
+
+
+/* Encode what the vector loops cannot take: two bytes at a time from
+ * `hencs', as lshpack_enc_huff_encode() does, and a byte at a time where
+ * the codes of the two are longer than 32 bits.
+ */
+static int
+simd_put_bytes (uint64_t *acc, unsigned *used, unsigned char **p_dst,
+        unsigned char *dst_end, const unsigned char *src, unsigned n)
+{
+    const unsigned char *const src_end = src + n;
+    const struct henc *henc;
+    struct encode_el el;
+    uint16_t idx;
+
+    for (; src + 2 <= src_end; src += 2)
+    {
+        memcpy(&idx, src, 2);
+        henc = &hencs[idx];
+        if (henc->lens < 64)
+        {
+            if (0 != simd_put(acc, used, p_dst, dst_end, henc->code,
+                                                                henc->lens))
+                return -1;
+        }
+        else
+        {
+            el = encode_table[src[0]];
+            if (0 != simd_put(acc, used, p_dst, dst_end, el.code, el.bits))
+                return -1;
+            el = encode_table[src[1]];
+            if (0 != simd_put(acc, used, p_dst, dst_end, el.code, el.bits))
+                return -1;
+        }
+    }
+    if (src < src_end)
+    {
+        el = encode_table[*src];
+        if (0 != simd_put(acc, used, p_dst, dst_end, el.code, el.bits))
+            return -1;
+    }
+
+    return 0;
+}
+
+
+/* Encode the last bytes and pad.  As in lshpack_enc_huff_encode(), -1
+ * means that the output does not fit.
+ */
+static int
+simd_finish (uint64_t acc, unsigned used, const unsigned char *src,
+        const unsigned char *src_end, unsigned char *dst,
+        unsigned char *p_dst, unsigned char *dst_end)
+{
+    unsigned n;
+
+    if (0 != simd_put_bytes(&acc, &used, &p_dst, dst_end, src,
+                                                            src_end - src))
+        return -1;
+
+    n = (used + 7) >> 3;
+    if (dst_end - p_dst < n)
+        return -1;
+    if (used)
+        acc |= ~0ull >> used;               /* EOF */
+    for (; n > 0; --n, acc <<= 8)
+        *p_dst++ = acc >> 56;
+
+    return p_dst - dst;
+}
+
+
+#if defined(__x86_64__)
+
+/* For vpermi2b: code lengths of ASCII bytes and the low and high bytes of
+ * their codes.  The vector loop takes codes of up to 16 bits: all printable
+ * ASCII but the backslash.
+ */
+static unsigned char simd_lens[128], simd_codes[2][128];
+
+/* For vpermb: the order of a block's bytes that the unpacks below turn
+ * into the order of the input (see simd_encode_avx512()).
+ */
+static unsigned char simd_order[SIMD_BLOCK];
+
+/* For vpermd: moves the 64-bit lanes set in the index to the bottom, in
+ * order, as vpcompressq does.
+ */
+static uint32_t simd_compress[16][8];
+
+
+static void
+simd_init_tables (void)
+{
+    unsigned i, j, n;
+
+    for (i = 0; i < 128; ++i)
+    {
+        simd_lens[i] = encode_table[i].bits;
+        simd_codes[0][i] = encode_table[i].code;
+        simd_codes[1][i] = encode_table[i].code >> 8;
+    }
+    for (i = 0; i < SIMD_BLOCK; ++i)
+    {
+        j = i & 15;
+        simd_order[i] = (i & ~15) + (j & 4) * 2 + (j & 8) / 2 + (j & 3);
+    }
+    for (i = 0; i < 16; ++i)
+        for (j = 0, n = 0; j < 4; ++j)
+            if (i & (1 << j))
+            {
+                simd_compress[i][n++] = j * 2;
+                simd_compress[i][n++] = j * 2 + 1;
+            }
+}
+
+
+/* Encode 64 bytes at a time:
+ *
+ *   1. Look up the lengths and the two bytes of the codes with vpermi2b;
+ *   2. Unpack the bytes of the codes into 16-bit lanes and merge the codes
+ *      two by two in 32-bit lanes and again in 64-bit lanes.  The bytes
+ *      were put in such an order that this leaves the codes of bytes 0-3,
+ *      8-11, 16-19, ... of the block in one register and of bytes 4-7,
+ *      12-15, 20-23, ... in another;
+ *   3. Merge those into eight codes of eight bytes each, if none of these
+ *      is longer than 64 bits;
+ *   4. Sum up their lengths to find where each of them begins;
+ *   5. Shift each into place in the 64-bit word where it begins and the
+ *      next one, if it goes on there; and
+ *   6. OR together what goes into the same word, write all eight words,
+ *      and keep the one that is not full.
+ *
+ * Blocks with a byte whose code is longer than 16 bits and those that fail
+ * the check in 3 go to simd_put_bytes().  At the end of input, the bytes
+ * past it are given a length of zero.
+ */
+static __attribute__((target("avx512f,avx512bw,avx512vbmi"))) int
+simd_encode_avx512 (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len)
+{
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    unsigned char *p_dst = dst;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i ones = _mm512_set1_epi64(-1);
+    const __m512i c64 = _mm512_set1_epi64(64);
+    const __m512i c63 = _mm512_set1_epi64(63);
+    const __m512i lo16 = _mm512_set1_epi32(0xFFFF);
+    const __m512i lo32 = _mm512_set1_epi64(0xFFFFFFFF);
+    const __m512i bswap = _mm512_set_epi8(
+                    56, 57, 58, 59, 60, 61, 62, 63,
+                    48, 49, 50, 51, 52, 53, 54, 55,
+                    40, 41, 42, 43, 44, 45, 46, 47,
+                    32, 33, 34, 35, 36, 37, 38, 39,
+                    24, 25, 26, 27, 28, 29, 30, 31,
+                    16, 17, 18, 19, 20, 21, 22, 23,
+                    8, 9, 10, 11, 12, 13, 14, 15,
+                    0, 1, 2, 3, 4, 5, 6, 7);
+    const __m512i order = _mm512_loadu_si512(simd_order);
+    const __m512i lens_lo = _mm512_loadu_si512(simd_lens);
+    const __m512i lens_hi = _mm512_loadu_si512(simd_lens + 64);
+    const __m512i code0_lo = _mm512_loadu_si512(simd_codes[0]);
+    const __m512i code0_hi = _mm512_loadu_si512(simd_codes[0] + 64);
+    const __m512i code1_lo = _mm512_loadu_si512(simd_codes[1]);
+    const __m512i code1_hi = _mm512_loadu_si512(simd_codes[1] + 64);
+    __m512i in, lens8, code0, code1, codes[2], lens[2], odd_lens, pairs,
+            pair_lens, quads[2], quad_lens[2], octets, octet_lens, ends,
+            begins, word_idx, shift, hi, lo, idx, words;
+    __mmask64 live;
+    __mmask8 same, last;
+    uint64_t acc, total;
+    unsigned used, full, h, n;
+
+    acc = 0;
+    used = 0;
+    while (src < src_end && dst_end - p_dst >= SIMD_MIN_ROOM)
+    {
+        n = src_end - src;
+        if (n >= SIMD_BLOCK)
+        {
+            n = SIMD_BLOCK;
+            live = ~0ull;
+            in = _mm512_loadu_si512(src);
+        }
+        else
+        {
+            live = ~0ull >> (SIMD_BLOCK - n);
+            in = _mm512_maskz_loadu_epi8(live, src);
+            live = _mm512_movepi8_mask(_mm512_permutexvar_epi8(order,
+                                                    _mm512_movm_epi8(live)));
+        }
+        if (_mm512_movepi8_mask(in))
+            goto by_pairs;
+        in = _mm512_permutexvar_epi8(order, in);
+        lens8 = _mm512_maskz_permutex2var_epi8(live, lens_lo, in, lens_hi);
+        if (_mm512_cmpgt_epu8_mask(lens8, _mm512_set1_epi8(16)))
+            goto by_pairs;
+        code0 = _mm512_maskz_permutex2var_epi8(live, code0_lo, in, code0_hi);
+        code1 = _mm512_maskz_permutex2var_epi8(live, code1_lo, in, code1_hi);
+
+        codes[0] = _mm512_unpacklo_epi8(code0, code1);
+        codes[1] = _mm512_unpackhi_epi8(code0, code1);
+        lens[0] = _mm512_unpacklo_epi8(lens8, zero);
+        lens[1] = _mm512_unpackhi_epi8(lens8, zero);
+        for (h = 0; h < 2; ++h)
+        {
+            odd_lens = _mm512_srli_epi32(lens[h], 16);
+            pairs = _mm512_or_si512(
+                    _mm512_sllv_epi32(_mm512_and_si512(codes[h], lo16),
+                                                                    odd_lens),
+                    _mm512_srli_epi32(codes[h], 16));
+            pair_lens = _mm512_add_epi32(_mm512_and_si512(lens[h], lo16),
+                                                                    odd_lens);
+            odd_lens = _mm512_srli_epi64(pair_lens, 32);
+            quads[h] = _mm512_or_si512(
+                    _mm512_sllv_epi64(_mm512_and_si512(pairs, lo32),
+                                                                    odd_lens),
+                    _mm512_srli_epi64(pairs, 32));
+            quad_lens[h] = _mm512_add_epi64(
+                            _mm512_and_si512(pair_lens, lo32), odd_lens);
+        }
+        octet_lens = _mm512_add_epi64(quad_lens[0], quad_lens[1]);
+        if (_mm512_cmpgt_epu64_mask(octet_lens, c64))
+            goto by_pairs;
+        octets = _mm512_or_si512(_mm512_sllv_epi64(quads[0], quad_lens[1]),
+                                                                    quads[1]);
+
+        /* Where each octet ends, counting from the top of `acc' */
+        ends = _mm512_add_epi64(octet_lens,
+                                _mm512_alignr_epi64(octet_lens, zero, 7));
+        ends = _mm512_add_epi64(ends, _mm512_alignr_epi64(ends, zero, 6));
+        ends = _mm512_add_epi64(ends, _mm512_alignr_epi64(ends, zero, 4));
+        total = _mm_cvtsi128_si64(_mm512_castsi512_si128(
+                    _mm512_permutexvar_epi64(_mm512_set1_epi64(7), ends)));
+        ends = _mm512_add_epi64(ends, _mm512_set1_epi64(used));
+        begins = _mm512_sub_epi64(ends, octet_lens);
+        word_idx = _mm512_srli_epi64(begins, 6);
+
+        /* What goes into the word where the octet begins and into the next
+         * one.  Shift counts of 64 or more, which negative ones are, too,
+         * give zero.
+         */
+        shift = _mm512_sub_epi64(_mm512_sub_epi64(c64, octet_lens),
+                                            _mm512_and_si512(begins, c63));
+        hi = _mm512_or_si512(_mm512_sllv_epi64(octets, shift),
+                    _mm512_srlv_epi64(octets, _mm512_sub_epi64(zero, shift)));
+        lo = _mm512_sllv_epi64(octets, _mm512_add_epi64(c64, shift));
+
+        /* OR each octet with those before it in the same word: the last one
+         * in each word then has all of them, and only it may go on into the
+         * next word.  Octets are at least 40 bits long, so no more than two
+         * begin in the same word, except at the end of input.
+         */
+        same = _mm512_cmpeq_epi64_mask(word_idx,
+                                    _mm512_alignr_epi64(word_idx, ones, 7));
+        hi = _mm512_mask_or_epi64(hi, same, hi,
+                                    _mm512_alignr_epi64(hi, zero, 7));
+        if (live != ~0ull)
+        {
+            same = _mm512_cmpeq_epi64_mask(word_idx,
+                                    _mm512_alignr_epi64(word_idx, ones, 6));
+            hi = _mm512_mask_or_epi64(hi, same, hi,
+                                    _mm512_alignr_epi64(hi, zero, 6));
+            same = _mm512_cmpeq_epi64_mask(word_idx,
+                                    _mm512_alignr_epi64(word_idx, ones, 4));
+            hi = _mm512_mask_or_epi64(hi, same, hi,
+                                    _mm512_alignr_epi64(hi, zero, 4));
+        }
+        last = _mm512_cmpneq_epi64_mask(word_idx,
+                                _mm512_alignr_epi64(ones, word_idx, 1));
+
+        /* Every word but the one after the last octet has an octet that
+         * begins in it, so compressing lines them up.  What goes on into
+         * the next word goes one lane up; from the last octet, it may go
+         * into a ninth word.
+         */
+        words = _mm512_or_si512(_mm512_maskz_compress_epi64(last, hi),
+                    _mm512_alignr_epi64(
+                        _mm512_maskz_compress_epi64(last, lo), zero, 7));
+        words = _mm512_or_si512(words, _mm512_maskz_set1_epi64(1, acc));
+        _mm512_storeu_si512(p_dst, _mm512_shuffle_epi8(words, bswap));
+
+        total += used;
+        full = total >> 6;
+        used = total & 63;
+        idx = _mm512_set1_epi64(full == 8 ? 15 : full);
+        acc = _mm_cvtsi128_si64(_mm512_castsi512_si128(
+                                _mm512_permutex2var_epi64(words, idx, lo)));
+        p_dst += full * 8;
+        src += n;
+        continue;
+
+  by_pairs:
+        (void) simd_put_bytes(&acc, &used, &p_dst, dst_end, src, n);
+        src += n;
+    }
+
+    return simd_finish(acc, used, src, src_end, dst, p_dst, dst_end);
+}
+
+
+/* The `hencs' entry as one 64-bit lane: the code above the length */
+static inline long long
+simd_henc (uint16_t idx)
+{
+    return (long long) ((uint64_t) hencs[idx].code << 32 | hencs[idx].lens);
+}
+
+
+/* Encode 32 bytes at a time the way simd_encode_avx512() does, with what
+ * AVX2 has:
+ *
+ *   1. Look up the codes of pairs of bytes in `hencs', as
+ *      lshpack_enc_huff_encode() does, and put them in registers four at a
+ *      time.  vpgatherdq is slower than the sixteen loads;
+ *   2. Merge them into four codes of eight bytes each, if none of these is
+ *      longer than 64 bits.  A pair whose codes are longer than 32 bits
+ *      has a length of 64 in `hencs', so this checks for those, too;
+ *   3. to 6. as in simd_encode_avx512(), but with a table of vpermd indices
+ *      in place of vpcompressq.
+ *
+ * Blocks that fail the check in 2 and the last 31 bytes or fewer go to
+ * simd_put_bytes().
+ */
+static __attribute__((target("avx2"))) int
+simd_encode_avx2 (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len)
+{
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    unsigned char *p_dst = dst;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi64x(-1);
+    const __m256i c64 = _mm256_set1_epi64x(64);
+    const __m256i c63 = _mm256_set1_epi64x(63);
+    const __m256i bswap = _mm256_set_epi8(
+                    8, 9, 10, 11, 12, 13, 14, 15,
+                    0, 1, 2, 3, 4, 5, 6, 7,
+                    8, 9, 10, 11, 12, 13, 14, 15,
+                    0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i dword_idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i idx, pairs[4], codes[4], lens[4], lo_codes, hi_codes,
+            lo_lens, hi_lens, quads[2], quad_lens[2], octets, octet_lens,
+            ends, begins, word_idx, shift, hi, lo, prev, next, keep, words;
+    uint16_t idx16[4];
+    uint64_t acc, total;
+    unsigned used, full, last, k;
+
+    acc = 0;
+    used = 0;
+    while (src + SIMD_BLOCK / 2 <= src_end
+                                && dst_end - p_dst >= SIMD_MIN_ROOM)
+    {
+        /* Pairs of bytes 0-7, 8-15, 16-23, and 24-31 */
+        for (k = 0; k < 4; ++k)
+        {
+            memcpy(idx16, src + 8 * k, sizeof(idx16));
+            pairs[k] = _mm256_set_epi64x(
+                            simd_henc(idx16[3]), simd_henc(idx16[2]),
+                            simd_henc(idx16[1]), simd_henc(idx16[0]));
+            codes[k] = _mm256_srli_epi64(pairs[k], 32);
+            lens[k] = _mm256_blend_epi32(pairs[k], zero, 0xAA);
+        }
+
+        /* Quads of bytes 0-3, 8-11, 4-7, 12-15 and of 16-19, 24-27, 20-23,
+         * 28-31: the lower 128 bits of each have the first halves of the
+         * octets and the upper ones the second.
+         */
+        for (k = 0; k < 2; ++k)
+        {
+            lo_codes = _mm256_unpacklo_epi64(codes[2 * k], codes[2 * k + 1]);
+            hi_codes = _mm256_unpackhi_epi64(codes[2 * k], codes[2 * k + 1]);
+            lo_lens = _mm256_unpacklo_epi64(lens[2 * k], lens[2 * k + 1]);
+            hi_lens = _mm256_unpackhi_epi64(lens[2 * k], lens[2 * k + 1]);
+            quads[k] = _mm256_or_si256(_mm256_sllv_epi64(lo_codes, hi_lens),
+                                                                    hi_codes);
+            quad_lens[k] = _mm256_add_epi64(lo_lens, hi_lens);
+        }
+        lo_lens = _mm256_permute2x128_si256(quad_lens[0], quad_lens[1], 0x20);
+        hi_lens = _mm256_permute2x128_si256(quad_lens[0], quad_lens[1], 0x31);
+        octet_lens = _mm256_add_epi64(lo_lens, hi_lens);
+        if (_mm256_movemask_pd(_mm256_castsi256_pd(
+                                    _mm256_cmpgt_epi64(octet_lens, c64))))
+            goto by_pairs;
+        octets = _mm256_or_si256(
+                _mm256_sllv_epi64(
+                    _mm256_permute2x128_si256(quads[0], quads[1], 0x20),
+                    hi_lens),
+                _mm256_permute2x128_si256(quads[0], quads[1], 0x31));
+
+        /* Where each octet ends, counting from the top of `acc' */
+        ends = _mm256_add_epi64(octet_lens, _mm256_blend_epi32(
+                        _mm256_permute4x64_epi64(octet_lens, 0x90), zero, 3));
+        ends = _mm256_add_epi64(ends,
+                                _mm256_permute2x128_si256(ends, ends, 0x08));
+        total = _mm256_extract_epi64(ends, 3);
+        ends = _mm256_add_epi64(ends, _mm256_set1_epi64x(used));
+        begins = _mm256_sub_epi64(ends, octet_lens);
+        word_idx = _mm256_srli_epi64(begins, 6);
+
+        shift = _mm256_sub_epi64(_mm256_sub_epi64(c64, octet_lens),
+                                            _mm256_and_si256(begins, c63));
+        hi = _mm256_or_si256(_mm256_sllv_epi64(octets, shift),
+                    _mm256_srlv_epi64(octets, _mm256_sub_epi64(zero, shift)));
+        lo = _mm256_sllv_epi64(octets, _mm256_add_epi64(c64, shift));
+
+        prev = _mm256_blend_epi32(_mm256_permute4x64_epi64(word_idx, 0x90),
+                                                                    ones, 3);
+        hi = _mm256_or_si256(hi, _mm256_and_si256(
+                    _mm256_cmpeq_epi64(word_idx, prev),
+                    _mm256_permute4x64_epi64(hi, 0x90)));
+        next = _mm256_blend_epi32(_mm256_permute4x64_epi64(word_idx, 0xF9),
+                                                                ones, 0xC0);
+        last = ~_mm256_movemask_pd(_mm256_castsi256_pd(
+                                _mm256_cmpeq_epi64(word_idx, next))) & 15;
+
+        idx = _mm256_loadu_si256((const void *) simd_compress[last]);
+        keep = _mm256_cmpgt_epi32(
+                _mm256_set1_epi32(__builtin_popcount(last) * 2), dword_idx);
+        hi = _mm256_and_si256(_mm256_permutevar8x32_epi32(hi, idx), keep);
+        lo = _mm256_and_si256(_mm256_permutevar8x32_epi32(lo, idx), keep);
+        words = _mm256_or_si256(hi, _mm256_blend_epi32(
+                        _mm256_permute4x64_epi64(lo, 0x90), zero, 3));
+        words = _mm256_or_si256(words, _mm256_set_epi64x(0, 0, 0, acc));
+        _mm256_storeu_si256((void *) p_dst, _mm256_shuffle_epi8(words, bswap));
+
+        total += used;
+        full = total >> 6;
+        used = total & 63;
+        if (full < 4)
+            acc = _mm_cvtsi128_si64(_mm256_castsi256_si128(
+                    _mm256_permutevar8x32_epi32(words,
+                        _mm256_set1_epi64x((uint64_t) (full * 2 + 1) << 32
+                                                                | full * 2))));
+        else
+            acc = _mm256_extract_epi64(lo, 3);     /* Into a fifth word */
+        p_dst += full * 8;
+        src += SIMD_BLOCK / 2;
+        continue;
+
+  by_pairs:
+        (void) simd_put_bytes(&acc, &used, &p_dst, dst_end, src,
+                                                            SIMD_BLOCK / 2);
+        src += SIMD_BLOCK / 2;
+    }
+
+    return simd_finish(acc, used, src, src_end, dst, p_dst, dst_end);
+}
+
+#endif
+
+
+static encode_f simd_encode, avx2_encode;
+
+
+/* Encode using AVX-512 if the CPU has it and lshpack_enc_huff_encode()
+ * otherwise or if the string is short.  The AVX2 loop is not picked: it
+ * was 5 to 10% slower than lshpack_enc_huff_encode() on the Xeon this was
+ * measured on.
+ */
+int
+lshpack_enc_huff_encode_simd (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len)
+{
+    if (!simd_encode)
+    {
+#if defined(__x86_64__)
+        if (__builtin_cpu_supports("avx512f")
+                && __builtin_cpu_supports("avx512bw")
+                && __builtin_cpu_supports("avx512vbmi"))
+        {
+            simd_init_tables();
+            simd_encode = simd_encode_avx512;
+        }
+        else
+#endif
+            simd_encode = lshpack_enc_huff_encode;
+    }
+    if (src_len < SIMD_MIN_LEN)
+        return lshpack_enc_huff_encode(src, src_len, dst, dst_len);
+    return simd_encode(src, src_len, dst, dst_len);
+}
+
+
+/* The same with the AVX2 loop, to measure it on its own */
+int
+lshpack_enc_huff_encode_avx2 (const unsigned char *src, int src_len,
+                                        unsigned char *dst, int dst_len)
+{
+    if (!avx2_encode)
+    {
+#if defined(__x86_64__)
+        if (__builtin_cpu_supports("avx2"))
+        {
+            simd_init_tables();
+            avx2_encode = simd_encode_avx2;
+        }
+        else
+#endif
+            avx2_encode = lshpack_enc_huff_encode;
+    }
+    if (src_len < SIMD_MIN_LEN)
+        return lshpack_enc_huff_encode(src, src_len, dst, dst_len);
+    return avx2_encode(src, src_len, dst, dst_len);
+}